@@ -0,0 +1,191 @@
+/**
+ * @file      sys.Atomic.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_ATOMIC_HPP_
+#define SYS_ATOMIC_HPP_
+
+#include "sys.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Atomic
+ * @brief Atomic variable on GCC atomic built-in functions.
+ *
+ * @note The class is not derived from the Object class as it has to be as small as the value it holds,
+ * to be embeddable into cache-line sensitive structures and to be usable as a futex word.
+ *
+ * @tparam T Integral or pointer type of the value.
+ */
+template <typename T>
+class Atomic
+{
+
+public:
+
+    /**
+     * @enum Order
+     * @brief Memory order of an atomic operation.
+     */
+    enum Order
+    {
+        ORDER_RELAXED = __ATOMIC_RELAXED, ///< @brief No inter-thread ordering constraints.
+        ORDER_ACQUIRE = __ATOMIC_ACQUIRE, ///< @brief Acquire ordering for loads.
+        ORDER_RELEASE = __ATOMIC_RELEASE, ///< @brief Release ordering for stores.
+        ORDER_ACQ_REL = __ATOMIC_ACQ_REL, ///< @brief Acquire and release ordering for read-modify-write.
+        ORDER_SEQ_CST = __ATOMIC_SEQ_CST  ///< @brief Sequentially consistent ordering.
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param value Initial value.
+     */
+    explicit Atomic(T value);
+
+    /**
+     * @brief Destructor.
+     */
+    ~Atomic();
+
+    /**
+     * @brief Loads the value.
+     *
+     * @param order Memory order.
+     * @return The value.
+     */
+    T load(Order order = ORDER_SEQ_CST) const;
+
+    /**
+     * @brief Stores a value.
+     *
+     * @param value A value to store.
+     * @param order Memory order.
+     */
+    void store(T value, Order order = ORDER_SEQ_CST);
+
+    /**
+     * @brief Replaces the value.
+     *
+     * @param value A value to store.
+     * @param order Memory order.
+     * @return The previous value.
+     */
+    T exchange(T value, Order order = ORDER_SEQ_CST);
+
+    /**
+     * @brief Replaces the value if it equals to an expected one.
+     *
+     * @param expected An expected value, which is set to the actual value on failure.
+     * @param desired  A value to store.
+     * @param order    Memory order.
+     * @return True if the value has been replaced.
+     */
+    bool_t compareExchange(T& expected, T desired, Order order = ORDER_SEQ_CST);
+
+    /**
+     * @brief Adds to the value.
+     *
+     * @param value A value to add.
+     * @param order Memory order.
+     * @return The previous value.
+     */
+    T fetchAdd(T value, Order order = ORDER_SEQ_CST);
+
+    /**
+     * @brief Subtracts from the value.
+     *
+     * @param value A value to subtract.
+     * @param order Memory order.
+     * @return The previous value.
+     */
+    T fetchSub(T value, Order order = ORDER_SEQ_CST);
+
+    /**
+     * @brief Returns address of the value.
+     *
+     * @return The value address.
+     */
+    T* getAddress();
+
+private:
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    Atomic(Atomic const&); ///< SCA MISRA-C++:2008 Justified Rule 3-2-2 and Rule 3-2-4
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    Atomic& operator=(Atomic const&); ///< SCA MISRA-C++:2008 Justified Rule 3-2-2 and Rule 3-2-4
+
+    /**
+     * @brief The value.
+     */
+    T value_;
+
+};
+
+template <typename T>
+Atomic<T>::Atomic(T value)
+    : value_( value ) {
+}
+
+template <typename T>
+Atomic<T>::~Atomic()
+{
+}
+
+template <typename T>
+T Atomic<T>::load(Order order) const
+{
+    return __atomic_load_n(&value_, order);
+}
+
+template <typename T>
+void Atomic<T>::store(T value, Order order)
+{
+    __atomic_store_n(&value_, value, order);
+}
+
+template <typename T>
+T Atomic<T>::exchange(T value, Order order)
+{
+    return __atomic_exchange_n(&value_, value, order);
+}
+
+template <typename T>
+bool_t Atomic<T>::compareExchange(T& expected, T desired, Order order)
+{
+    // The failure order shall not be stronger than the success one and shall not contain a release
+    int_t const failure( ( (order == ORDER_RELEASE) || (order == ORDER_RELAXED) ) ? ORDER_RELAXED : ORDER_ACQUIRE );
+    return __atomic_compare_exchange_n(&value_, &expected, desired, false, order, failure);
+}
+
+template <typename T>
+T Atomic<T>::fetchAdd(T value, Order order)
+{
+    return __atomic_fetch_add(&value_, value, order);
+}
+
+template <typename T>
+T Atomic<T>::fetchSub(T value, Order order)
+{
+    return __atomic_fetch_sub(&value_, value, order);
+}
+
+template <typename T>
+T* Atomic<T>::getAddress()
+{
+    return &value_;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_ATOMIC_HPP_
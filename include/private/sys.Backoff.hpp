@@ -0,0 +1,114 @@
+/**
+ * @file      sys.Backoff.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_BACKOFF_HPP_
+#define SYS_BACKOFF_HPP_
+
+#include "sys.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Backoff
+ * @brief Exponential backoff of a spin-wait loop.
+ */
+class Backoff
+{
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Backoff();
+
+    /**
+     * @brief Destructor.
+     */
+    ~Backoff();
+
+    /**
+     * @brief Relaxes the CPU for the current number of iterations and doubles the number up to the limit.
+     */
+    void pause();
+
+    /**
+     * @brief Tests if the number of iterations has reached the limit.
+     *
+     * @return True if the limit is reached.
+     */
+    bool_t isSaturated() const;
+
+    /**
+     * @brief Relaxes the CPU for one spin-wait loop iteration.
+     */
+    static void relax();
+
+private:
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    Backoff(Backoff const&); ///< SCA MISRA-C++:2008 Justified Rule 3-2-2 and Rule 3-2-4
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    Backoff& operator=(Backoff const&); ///< SCA MISRA-C++:2008 Justified Rule 3-2-2 and Rule 3-2-4
+
+    /**
+     * @brief Maximum number of iterations of one pause.
+     */
+    static const uint32_t LIMIT = 1024U;
+
+    /**
+     * @brief Number of iterations of the next pause.
+     */
+    uint32_t count_;
+
+};
+
+inline Backoff::Backoff()
+    : count_( 1U ) {
+}
+
+inline Backoff::~Backoff()
+{
+}
+
+inline void Backoff::pause()
+{
+    for(uint32_t i(0U); i < count_; i++)
+    {
+        relax();
+    }
+    if( count_ < LIMIT )
+    {
+        count_ <<= 1;
+    }
+}
+
+inline bool_t Backoff::isSaturated() const
+{
+    return count_ >= LIMIT;
+}
+
+inline void Backoff::relax()
+{
+    #if defined (__i386__) || defined (__x86_64__)
+    __builtin_ia32_pause();
+    #elif defined (__aarch64__) || defined (__arm__)
+    __asm__ __volatile__("yield" ::: "memory");
+    #else
+    __asm__ __volatile__("" ::: "memory");
+    #endif
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_BACKOFF_HPP_
@@ -0,0 +1,60 @@
+/**
+ * @file      sys.BusyPoll.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_BUSYPOLL_HPP_
+#define SYS_BUSYPOLL_HPP_
+
+#include "sys.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class BusyPoll
+ * @brief Busy-poll mode of a thread.
+ *
+ * A thread in the busy-poll mode waits for mutexes and semaphores in a spin-wait loop
+ * instead of sleeping in the kernel. The mode is intended for threads dedicated to
+ * isolated CPUs, where spinning costs nothing to other threads but wakes up in
+ * microseconds.
+ */
+class BusyPoll
+{
+
+public:
+
+    /**
+     * @brief Tests if the calling thread is in the busy-poll mode.
+     *
+     * @return True if the mode is enabled.
+     */
+    static bool_t isEnabled();
+
+    /**
+     * @brief Sets the busy-poll mode of the calling thread.
+     *
+     * @param enable True to enable the mode.
+     */
+    static void setEnabled(bool_t enable);
+
+private:
+
+    /**
+     * @brief The busy-poll mode flag of a thread.
+     */
+    static __thread bool_t isEnabled_;
+
+};
+
+inline bool_t BusyPoll::isEnabled()
+{
+    return isEnabled_;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_BUSYPOLL_HPP_
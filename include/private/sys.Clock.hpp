@@ -0,0 +1,67 @@
+/**
+ * @file      sys.Clock.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CLOCK_HPP_
+#define SYS_CLOCK_HPP_
+
+#include "sys.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Clock
+ * @brief Time of POSIX clocks for timed waits.
+ */
+class Clock
+{
+
+public:
+
+    /**
+     * @brief Infinite timeout.
+     */
+    static const int64_t TIMEOUT_INFINITE = -1;
+
+    /**
+     * @brief Returns current time of a clock.
+     *
+     * @param clock The clock identifier.
+     * @return Time in nanoseconds.
+     */
+    static int64_t getTime(::clockid_t clock = CLOCK_MONOTONIC);
+
+    /**
+     * @brief Returns an absolute deadline of a relative timeout.
+     *
+     * @param timeout Relative timeout in nanoseconds.
+     * @param clock   The clock identifier the deadline is measured by.
+     * @return The deadline.
+     */
+    static ::timespec getDeadline(int64_t timeout, ::clockid_t clock = CLOCK_MONOTONIC);
+
+};
+
+inline int64_t Clock::getTime(::clockid_t const clock)
+{
+    ::timespec time = { 0, 0 };
+    static_cast<void>( ::clock_gettime(clock, &time) );
+    return static_cast<int64_t>(time.tv_sec) * 1000000000LL + static_cast<int64_t>(time.tv_nsec);
+}
+
+inline ::timespec Clock::getDeadline(int64_t const timeout, ::clockid_t const clock)
+{
+    int64_t const deadline( getTime(clock) + timeout );
+    ::timespec time = { 0, 0 };
+    time.tv_sec = static_cast< ::time_t >(deadline / 1000000000LL);
+    time.tv_nsec = static_cast<long>(deadline % 1000000000LL);
+    return time;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CLOCK_HPP_
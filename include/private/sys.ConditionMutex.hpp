@@ -0,0 +1,66 @@
+/**
+ * @file      sys.ConditionMutex.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CONDITIONMUTEX_HPP_
+#define SYS_CONDITIONMUTEX_HPP_
+
+#include "api.Mutex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ConditionMutex
+ * @brief Interface of system mutexes.
+ *
+ * The interface extends the API mutex with a timed lock, and with functions condition variables wait with.
+ * A condition variable moves threads waiting with a mutex which has a futex word to sleep
+ * on the word, and the threads lock the mutex as threads which have slept on the word.
+ */
+class ConditionMutex : public api::Mutex
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ConditionMutex() = 0;
+
+    using api::Mutex::lock;
+
+    /**
+     * @brief Locks the mutex waiting for a limited time.
+     *
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the mutex has been locked, false if the timeout has expired or an error occurred.
+     */
+    virtual bool_t lock(int64_t timeout) = 0;
+
+    /**
+     * @brief Returns the futex word threads sleep on while the mutex is locked.
+     *
+     * @return The word address, or NULLPTR if the mutex has no futex word.
+     */
+    virtual int32_t* getRequeueWord() = 0;
+
+    /**
+     * @brief Locks the mutex by a thread which may have been moved to sleep on the word.
+     *
+     * @return True if the mutex has been locked.
+     */
+    virtual bool_t lockRequeued() = 0;
+
+};
+
+inline ConditionMutex::~ConditionMutex()
+{
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CONDITIONMUTEX_HPP_
@@ -0,0 +1,268 @@
+/**
+ * @file      sys.ConditionVariable.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CONDITIONVARIABLE_HPP_
+#define SYS_CONDITIONVARIABLE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Mutex.hpp"
+#include "sys.ConditionMutex.hpp"
+#include "sys.Atomic.hpp"
+#include "sys.Futex.hpp"
+#include "sys.Clock.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ConditionVariable
+ * @brief Condition variable class.
+ *
+ * Waiting threads sleep on a sequence word, which each notification increments. If the threads
+ * wait with a system mutex having a futex word, they sleep on a sequence word of their own, and
+ * a notification of all of them wakes up one thread and moves the rest to sleep on the mutex word,
+ * thus the threads are woken up one by one as the mutex is unlocked instead of all at once
+ * to contend for the mutex. Threads waiting with other mutexes are never moved.
+ *
+ * @note All threads waiting on the variable at the same time shall wait with the same mutex.
+ *       A wait may return spuriously, thus a thread shall check its condition in a loop.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class ConditionVariable : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ConditionVariable();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ConditionVariable();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Unlocks a mutex and waits for a notification, then locks the mutex.
+     *
+     * @param mutex   The mutex locked by the calling thread.
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return False if the timeout has expired or an error occurred.
+     */
+    bool_t wait(api::Mutex& mutex, int64_t timeout = Clock::TIMEOUT_INFINITE);
+
+    /**
+     * @brief Unlocks a system mutex and waits for a notification, then locks the mutex.
+     *
+     * @param mutex   The mutex locked by the calling thread.
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return False if the timeout has expired or an error occurred.
+     */
+    bool_t wait(ConditionMutex& mutex, int64_t timeout = Clock::TIMEOUT_INFINITE);
+
+    /**
+     * @brief Wakes up one waiting thread.
+     *
+     * @return True if the notification is done.
+     */
+    bool_t notifyOne();
+
+    /**
+     * @brief Wakes up all waiting threads.
+     *
+     * @return True if the notification is done.
+     */
+    bool_t notifyAll();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Number of threads meaning all threads.
+     */
+    static const int32_t ALL = 0x7FFFFFFF;
+
+    /**
+     * @brief Sleeps until a notification.
+     *
+     * @param seq     The sequence word to sleep on.
+     * @param waiters The number of threads sleeping on the word.
+     * @param value   The sequence read before the mutex has been unlocked.
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return False if the timeout has expired or an error occurred.
+     */
+    static bool_t sleep(Atomic<int32_t>& seq, Atomic<int32_t>& waiters, int32_t value, int64_t timeout);
+
+    /**
+     * @brief The sequence word incremented by notifications, which threads waiting with other mutexes sleep on.
+     */
+    Atomic<int32_t> seq_;
+
+    /**
+     * @brief Number of threads sleeping on the sequence word.
+     */
+    Atomic<int32_t> waiters_;
+
+    /**
+     * @brief The sequence word incremented by notifications, which threads waiting with futex mutexes sleep on.
+     */
+    Atomic<int32_t> requeueSeq_;
+
+    /**
+     * @brief Number of threads sleeping on the requeue sequence word.
+     */
+    Atomic<int32_t> requeueWaiters_;
+
+    /**
+     * @brief Word of the futex mutex the threads wait with, or NULLPTR.
+     */
+    Atomic<int32_t*> target_;
+
+};
+
+template <class A>
+ConditionVariable<A>::ConditionVariable()
+    : NonCopyable<A>()
+    , seq_( 0 )
+    , waiters_( 0 )
+    , requeueSeq_( 0 )
+    , requeueWaiters_( 0 )
+    , target_( NULLPTR ) {
+}
+
+template <class A>
+ConditionVariable<A>::~ConditionVariable()
+{
+}
+
+template <class A>
+bool_t ConditionVariable<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t ConditionVariable<A>::wait(api::Mutex& mutex, int64_t const timeout)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        // The sequence is read under the mutex, thus a notification after the unlock changes it
+        int32_t const seq( seq_.load(Atomic<int32_t>::ORDER_ACQUIRE) );
+        if( mutex.unlock() )
+        {
+            res = sleep(seq_, waiters_, seq, timeout);
+            if( !mutex.lock() )
+            {   ///< UT Justified Branch: OS dependency
+                res = false;
+            }
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariable<A>::wait(ConditionMutex& mutex, int64_t const timeout)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        int32_t* const word( mutex.getRequeueWord() );
+        if( word == NULLPTR )
+        {
+            res = wait(static_cast<api::Mutex&>(mutex), timeout);
+        }
+        else
+        {
+            target_.store(word, Atomic<int32_t*>::ORDER_RELAXED);
+            int32_t const seq( requeueSeq_.load(Atomic<int32_t>::ORDER_ACQUIRE) );
+            if( mutex.unlock() )
+            {
+                res = sleep(requeueSeq_, requeueWaiters_, seq, timeout);
+                // The thread may have been moved to sleep on the mutex word
+                if( !mutex.lockRequeued() )
+                {   ///< UT Justified Branch: OS dependency
+                    res = false;
+                }
+            }
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariable<A>::notifyOne()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        static_cast<void>( seq_.fetchAdd(1) );
+        static_cast<void>( requeueSeq_.fetchAdd(1) );
+        int32_t woken( 0 );
+        if( requeueWaiters_.load() > 0 )
+        {
+            woken = Futex::wake(requeueSeq_.getAddress(), 1);
+        }
+        if( (woken <= 0) && (waiters_.load() > 0) )
+        {
+            static_cast<void>( Futex::wake(seq_.getAddress(), 1) );
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariable<A>::notifyAll()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        static_cast<void>( seq_.fetchAdd(1) );
+        int32_t const seq( requeueSeq_.fetchAdd(1) + 1 );
+        if( waiters_.load() > 0 )
+        {
+            static_cast<void>( Futex::wake(seq_.getAddress(), ALL) );
+        }
+        if( requeueWaiters_.load() > 0 )
+        {
+            int32_t* const target( target_.load(Atomic<int32_t*>::ORDER_RELAXED) );
+            // Wake all up if there is no mutex word, or another notification has changed the sequence
+            if( (target == NULLPTR) || (Futex::requeue(requeueSeq_.getAddress(), seq, 1, target) < 0) )
+            {
+                static_cast<void>( Futex::wake(requeueSeq_.getAddress(), ALL) );
+            }
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariable<A>::sleep(Atomic<int32_t>& seq, Atomic<int32_t>& waiters, int32_t const value, int64_t const timeout)
+{
+    static_cast<void>( waiters.fetchAdd(1) );
+    bool_t const res( Futex::wait(seq.getAddress(), value, timeout) );
+    static_cast<void>( waiters.fetchSub(1) );
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CONDITIONVARIABLE_HPP_
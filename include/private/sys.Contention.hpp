@@ -0,0 +1,344 @@
+/**
+ * @file      sys.Contention.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CONTENTION_HPP_
+#define SYS_CONTENTION_HPP_
+
+#include "sys.Types.hpp"
+#include "sys.Atomic.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Contention
+ * @brief Contention profiler of mutexes and semaphores.
+ *
+ * Each thread records events to its own buffer of per-object records, thus recording
+ * does not write shared cache lines. A report merges the records of all the threads.
+ * A buffer is returned at exit of its thread to be used by another thread with the records,
+ * and records of an object are removed on its destruction.
+ * Hold times are recorded for mutexes only, as a permit of a semaphore may be released
+ * by a thread other than the one which has acquired it.
+ * The profiler records events and has its buffers only if EOOS_GLOBAL_SYS_CONTENTION_PROFILE is defined,
+ * otherwise no reports are returned.
+ */
+class Contention
+{
+
+public:
+
+    /**
+     * @enum Kind
+     * @brief Kind of profiled objects.
+     */
+    enum Kind
+    {
+        KIND_MUTEX     = 1, ///< @brief Mutexes.
+        KIND_SEMAPHORE = 2  ///< @brief Semaphores.
+    };
+
+    /**
+     * @brief Number of histogram buckets, the bucket I counts times from 2^I to 2^(I+1) nanoseconds.
+     */
+    static const int32_t BUCKETS = 32;
+
+    /**
+     * @brief Number of top waiting call sites of an object.
+     */
+    static const int32_t SITES = 4;
+
+    /**
+     * @struct Site
+     * @brief Call site waited for an object.
+     *
+     * @note A call inlined to its caller is recorded at the site of the caller.
+     */
+    struct Site
+    {
+        /**
+         * @brief Return address of the call.
+         */
+        void const* address;
+
+        /**
+         * @brief Number of contended acquisitions and failures of the call.
+         */
+        int64_t count;
+    };
+
+    /**
+     * @struct Report
+     * @brief Contention of an object.
+     */
+    struct Report
+    {
+        /**
+         * @brief The object address as api::Mutex or api::Semaphore.
+         */
+        void const* object;
+
+        /**
+         * @brief Number of acquisitions.
+         */
+        int64_t acquisitions;
+
+        /**
+         * @brief Number of acquisitions which waited for the object.
+         */
+        int64_t contentions;
+
+        /**
+         * @brief Number of failed tries and expired timeouts.
+         */
+        int64_t failures;
+
+        /**
+         * @brief Total wait time in nanoseconds.
+         */
+        int64_t waitTime;
+
+        /**
+         * @brief Total hold time in nanoseconds, mutexes only.
+         */
+        int64_t holdTime;
+
+        /**
+         * @brief Wait time histogram.
+         */
+        int64_t waits[BUCKETS];
+
+        /**
+         * @brief Hold time histogram, mutexes only.
+         */
+        int64_t holds[BUCKETS];
+
+        /**
+         * @brief Top waiting call sites.
+         */
+        Site sites[SITES];
+    };
+
+    /**
+     * @brief Records an acquisition of an object.
+     *
+     * @param object      The object address.
+     * @param kind        The object kind.
+     * @param wait        The wait time in nanoseconds.
+     * @param isContended True if the object has not been acquired at once.
+     * @param site        The call site.
+     */
+    static void onAcquire(void const* object, Kind kind, int64_t wait, bool_t isContended, void const* site);
+
+    /**
+     * @brief Records a failed try or an expired timeout of an object.
+     *
+     * @param object The object address.
+     * @param kind   The object kind.
+     * @param site   The call site.
+     */
+    static void onFail(void const* object, Kind kind, void const* site);
+
+    /**
+     * @brief Records a release of an object.
+     *
+     * @param object The object address.
+     * @param kind   The object kind.
+     * @param hold   The hold time in nanoseconds.
+     */
+    static void onRelease(void const* object, Kind kind, int64_t hold);
+
+    /**
+     * @brief Removes the records of a destroyed object.
+     *
+     * @note The object shall not be used by any thread.
+     *
+     * @param object The object address.
+     * @param kind   The object kind.
+     */
+    static void onDestroy(void const* object, Kind kind);
+
+    /**
+     * @brief Returns reports of the most waited objects of a kind.
+     *
+     * @param kind    The object kind.
+     * @param reports Array for the reports ordered by total wait time descending.
+     * @param number  Size of the array.
+     * @return Number of the reports.
+     */
+    static int32_t getReports(Kind kind, Report* reports, int32_t number);
+
+    /**
+     * @brief Returns number of events not recorded for lack of buffers or records.
+     *
+     * @return Number of the events.
+     */
+    static int64_t getDropped();
+
+private:
+
+    /**
+     * @brief Number of thread buffers.
+     */
+    static const int32_t THREADS = EOOS_GLOBAL_SYS_CONTENTION_THREADS;
+
+    /**
+     * @brief Number of object records in a thread buffer.
+     */
+    static const int32_t RECORDS = EOOS_GLOBAL_SYS_CONTENTION_RECORDS;
+
+    /**
+     * @struct Record
+     * @brief Record of an object in a thread buffer.
+     *
+     * @note Fields are written by the owner thread only, and read by reports with relaxed loads.
+     */
+    struct Record
+    {
+        /**
+         * @brief The object kind.
+         */
+        int32_t kind;
+
+        /**
+         * @brief The contention, which object is published last.
+         */
+        Report report;
+    };
+
+    /**
+     * @struct Buffer
+     * @brief Buffer of a thread.
+     */
+    struct Buffer
+    {
+        /**
+         * @brief Object records hashed by object addresses.
+         */
+        Record records[RECORDS];
+
+        /**
+         * @brief The buffer is used by a thread, which is accessed by atomic operations.
+         */
+        int32_t isUsed;
+    };
+
+    /**
+     * @brief Returns the record of an object in the calling thread buffer.
+     *
+     * @param object The object address.
+     * @param kind   The object kind.
+     * @return The record, or NULLPTR if no record is available.
+     */
+    static Report* getReport(void const* object, Kind kind);
+
+    /**
+     * @brief Returns the calling thread buffer.
+     *
+     * @return The buffer, or NULLPTR if all the buffers are used.
+     */
+    static Buffer* getBuffer();
+
+    /**
+     * @brief Creates the key of the thread buffers returned at thread exits.
+     */
+    static void createKey();
+
+    /**
+     * @brief Returns the buffer of an exiting thread.
+     *
+     * @param buffer The buffer.
+     */
+    static void returnBuffer(void* buffer);
+
+    /**
+     * @brief Clears a record of a destroyed object.
+     *
+     * @param report The record.
+     */
+    static void clear(Report& report);
+
+    /**
+     * @brief Returns the histogram bucket of a time.
+     *
+     * @param time The time in nanoseconds.
+     * @return The bucket index.
+     */
+    static int32_t getBucket(int64_t time);
+
+    /**
+     * @brief Adds a call site to the top of a record.
+     *
+     * @param report The record.
+     * @param site   The call site.
+     */
+    static void addSite(Report& report, void const* site);
+
+    /**
+     * @brief Merges a record to a report.
+     *
+     * @param report The report.
+     * @param record The record.
+     */
+    static void merge(Report& report, Report const& record);
+
+    /**
+     * @brief Increments a counter written by one thread.
+     *
+     * @param counter The counter.
+     * @param value   The increment.
+     */
+    static void add(int64_t& counter, int64_t value);
+
+    /**
+     * @brief Loads a counter written by another thread.
+     *
+     * @param counter The counter.
+     * @return The counter value.
+     */
+    static int64_t get(int64_t const& counter);
+
+    /**
+     * @brief Buffers of threads.
+     */
+    static Buffer buffers_[THREADS];
+
+    /**
+     * @brief Number of buffers ever used, which are the first ones.
+     */
+    static Atomic<int32_t> count_;
+
+    /**
+     * @brief Object address of a record removed, which a lookup passes over.
+     */
+    static void const* const REMOVED;
+
+    /**
+     * @brief Key of the thread buffers.
+     */
+    static ::pthread_key_t key_;
+
+    /**
+     * @brief Control of the key creation.
+     */
+    static ::pthread_once_t once_;
+
+    /**
+     * @brief Number of events not recorded.
+     */
+    static Atomic<int64_t> dropped_;
+
+    /**
+     * @brief Buffer of a thread.
+     */
+    static __thread Buffer* buffer_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CONTENTION_HPP_
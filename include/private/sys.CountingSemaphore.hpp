@@ -0,0 +1,77 @@
+/**
+ * @file      sys.CountingSemaphore.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_COUNTINGSEMAPHORE_HPP_
+#define SYS_COUNTINGSEMAPHORE_HPP_
+
+#include "api.Semaphore.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class CountingSemaphore
+ * @brief Interface of system semaphores.
+ *
+ * The interface extends the API semaphore with a timed acquisition, and with acquisitions
+ * and releases of a number of permits at once.
+ */
+class CountingSemaphore : public api::Semaphore
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CountingSemaphore() = 0;
+
+    using api::Semaphore::acquire;
+    using api::Semaphore::release;
+
+    /**
+     * @brief Acquires one permit waiting for a limited time.
+     *
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the permit has been acquired, false if the timeout has expired or an error occurred.
+     */
+    virtual bool_t acquire(int64_t timeout) = 0;
+
+    /**
+     * @brief Acquires a number of permits waiting for a limited time.
+     *
+     * @param permits The number of permits.
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the permits have been acquired, false if the timeout has expired or an error occurred.
+     */
+    virtual bool_t acquire(int32_t permits, int64_t timeout) = 0;
+
+    /**
+     * @brief Acquires a number of permits if they are available.
+     *
+     * @param permits The number of permits.
+     * @return True if the permits have been acquired.
+     */
+    virtual bool_t tryAcquire(int32_t permits) = 0;
+
+    /**
+     * @brief Releases a number of permits at once.
+     *
+     * @param permits The number of permits.
+     * @return True if the permits have been released.
+     */
+    virtual bool_t release(int32_t permits) = 0;
+
+};
+
+inline CountingSemaphore::~CountingSemaphore()
+{
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_COUNTINGSEMAPHORE_HPP_
@@ -0,0 +1,545 @@
+/**
+ * @file      sys.DeadlineScheduler.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_DEADLINESCHEDULER_HPP_
+#define SYS_DEADLINESCHEDULER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Atomic.hpp"
+#include "sys.Clock.hpp"
+#include "sys.Mutex.hpp"
+#include "sys.Semaphore.hpp"
+#include "api.Scheduler.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class DeadlineScheduler
+ * @brief Earliest deadline first scheduler of tasks on a pool of threads.
+ *
+ * Submitted tasks are dispatched to the pool threads in order of their absolute deadlines.
+ * A task executing on a pool thread may call the yield function to let a task with an earlier
+ * deadline be executed in place before the task continues.
+ *
+ * @tparam N Maximum number of submitted tasks not dispatched yet.
+ */
+template <int32_t N>
+class DeadlineScheduler : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @class Listener
+     * @brief Listener of missed deadlines.
+     */
+    class Listener
+    {
+
+    public:
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Listener() {}
+
+        /**
+         * @brief Handles a task completed after its deadline.
+         *
+         * @param task     The task.
+         * @param lateness Time in nanoseconds the task completed after its deadline.
+         */
+        virtual void onMiss(api::Task& task, int64_t lateness) = 0;
+
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param scheduler The scheduler to create pool threads.
+     * @param threads   Number of pool threads.
+     */
+    DeadlineScheduler(api::Scheduler& scheduler, int32_t threads);
+
+    /**
+     * @brief Destructor.
+     *
+     * @note The pool threads complete all the submitted tasks before exit.
+     */
+    virtual ~DeadlineScheduler();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Submits a task.
+     *
+     * @param task    The task to execute.
+     * @param timeout Relative deadline of the task completion in nanoseconds.
+     * @return True if the task has been submitted, false if the queue is full or the scheduler is being destroyed.
+     */
+    bool_t submit(api::Task& task, int64_t timeout);
+
+    /**
+     * @brief Executes submitted tasks with earlier deadlines than the calling task has.
+     *
+     * @note The function has effect only if it is called by a task executing on a pool thread.
+     *
+     * @return True if a task has been executed.
+     */
+    bool_t yield();
+
+    /**
+     * @brief Sets a listener of missed deadlines.
+     *
+     * @param listener The listener, or NULLPTR to remove the listener.
+     */
+    void setListener(Listener* listener);
+
+    /**
+     * @brief Returns number of tasks completed after their deadlines.
+     *
+     * @return Number of missed deadlines.
+     */
+    int32_t getMissesNumber() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Maximum number of pool threads.
+     */
+    static const int32_t THREADS_MAX = EOOS_GLOBAL_SYS_PARALLEL_THREADS;
+
+    /**
+     * @struct Job
+     * @brief Submitted task.
+     */
+    struct Job
+    {
+        /**
+         * @brief The task to execute.
+         */
+        api::Task* task;
+
+        /**
+         * @brief Absolute deadline in nanoseconds of the monotonic clock.
+         */
+        int64_t deadline;
+    };
+
+    /**
+     * @class Worker
+     * @brief Task of a pool thread.
+     */
+    class Worker : public NonCopyable<NoAllocator>, public api::Task
+    {
+        typedef NonCopyable<NoAllocator> Parent;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        Worker();
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Worker();
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const;
+
+        /**
+         * @copydoc eoos::api::Task::start()
+         */
+        virtual void start();
+
+        /**
+         * @copydoc eoos::api::Task::getStackSize()
+         */
+        virtual size_t getStackSize() const;
+
+        /**
+         * @brief Binds the worker to a scheduler.
+         *
+         * @param scheduler The scheduler.
+         */
+        void bind(DeadlineScheduler* scheduler);
+
+    private:
+
+        /**
+         * @brief The scheduler.
+         */
+        DeadlineScheduler* scheduler_;
+
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @param scheduler The scheduler to create pool threads.
+     * @param threads   Number of pool threads.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(api::Scheduler& scheduler, int32_t threads);
+
+    /**
+     * @brief Dispatches tasks until the scheduler is destroyed.
+     */
+    void work();
+
+    /**
+     * @brief Takes the job with the earliest deadline.
+     *
+     * @param job      The job taken.
+     * @param deadline Only a job with an earlier deadline is taken.
+     * @return True if a job has been taken.
+     */
+    bool_t take(Job& job, int64_t deadline);
+
+    /**
+     * @brief Executes a job.
+     *
+     * @param job The job.
+     */
+    void dispatch(Job const& job);
+
+    /**
+     * @brief Scheduler of the calling pool thread.
+     */
+    static __thread DeadlineScheduler* owner_;
+
+    /**
+     * @brief Deadline of the task executing on the calling pool thread.
+     */
+    static __thread int64_t deadline_;
+
+    /**
+     * @brief Binary min-heap of submitted jobs ordered by deadlines.
+     */
+    Job heap_[N];
+
+    /**
+     * @brief Number of submitted jobs.
+     */
+    int32_t size_;
+
+    /**
+     * @brief The heap guard.
+     */
+    Mutex<NoAllocator> mutex_;
+
+    /**
+     * @brief Number of submitted jobs for the pool threads.
+     */
+    Semaphore<NoAllocator> jobs_;
+
+    /**
+     * @brief Destruction flag, which is set under the mutex.
+     */
+    Atomic<bool_t> isStopping_;
+
+    /**
+     * @brief Listener of missed deadlines.
+     */
+    Atomic<Listener*> listener_;
+
+    /**
+     * @brief Number of missed deadlines.
+     */
+    Atomic<int32_t> misses_;
+
+    /**
+     * @brief Number of pool threads.
+     */
+    int32_t threadsNumber_;
+
+    /**
+     * @brief Pool threads.
+     */
+    api::Thread* threads_[THREADS_MAX];
+
+    /**
+     * @brief Pool thread tasks.
+     */
+    Worker workers_[THREADS_MAX];
+
+};
+
+template <int32_t N>
+__thread DeadlineScheduler<N>* DeadlineScheduler<N>::owner_( NULLPTR );
+
+template <int32_t N>
+__thread int64_t DeadlineScheduler<N>::deadline_( 0 );
+
+template <int32_t N>
+DeadlineScheduler<N>::DeadlineScheduler(api::Scheduler& scheduler, int32_t threads)
+    : NonCopyable<NoAllocator>()
+    , heap_()
+    , size_( 0 )
+    , mutex_()
+    , jobs_( 0 )
+    , isStopping_( false )
+    , listener_( NULLPTR )
+    , misses_( 0 )
+    , threadsNumber_( 0 )
+    , threads_()
+    , workers_() {
+    bool_t const isConstructed( construct(scheduler, threads) );
+    setConstructed( isConstructed );
+}
+
+template <int32_t N>
+DeadlineScheduler<N>::~DeadlineScheduler()
+{
+    // A job submitted before the flag is set under the mutex is in the heap, which workers drain before exit
+    static_cast<void>( mutex_.lock() );
+    isStopping_.store(true);
+    static_cast<void>( mutex_.unlock() );
+    for(int32_t i(0); i < threadsNumber_; i++)
+    {
+        static_cast<void>( jobs_.release() );
+    }
+    for(int32_t i(0); i < threadsNumber_; i++)
+    {
+        static_cast<void>( threads_[i]->join() );
+        delete threads_[i];
+    }
+}
+
+template <int32_t N>
+bool_t DeadlineScheduler<N>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <int32_t N>
+bool_t DeadlineScheduler<N>::submit(api::Task& task, int64_t timeout)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        Job job = { &task, Clock::getTime() + timeout };
+        static_cast<void>( mutex_.lock() );
+        if( (size_ < N) && !isStopping_.load(Atomic<bool_t>::ORDER_RELAXED) )
+        {
+            // Sift the new job up
+            int32_t index( size_ );
+            while( index > 0 )
+            {
+                int32_t const parent( (index - 1) / 2 );
+                if( heap_[parent].deadline <= job.deadline )
+                {
+                    break;
+                }
+                heap_[index] = heap_[parent];
+                index = parent;
+            }
+            heap_[index] = job;
+            size_++;
+            res = true;
+        }
+        static_cast<void>( mutex_.unlock() );
+        if( res )
+        {
+            static_cast<void>( jobs_.release() );
+        }
+    }
+    return res;
+}
+
+template <int32_t N>
+bool_t DeadlineScheduler<N>::yield()
+{
+    bool_t res( false );
+    if( isConstructed() && (owner_ == this) )
+    {
+        Job job;
+        while( take(job, deadline_) )
+        {
+            // The job permit is left in the semaphore, and a pool thread will find no job for it
+            int64_t const deadline( deadline_ );
+            dispatch(job);
+            deadline_ = deadline;
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <int32_t N>
+void DeadlineScheduler<N>::setListener(Listener* listener)
+{
+    listener_.store(listener);
+}
+
+template <int32_t N>
+int32_t DeadlineScheduler<N>::getMissesNumber() const
+{
+    return misses_.load();
+}
+
+template <int32_t N>
+bool_t DeadlineScheduler<N>::construct(api::Scheduler& scheduler, int32_t threads)
+{
+    bool_t res( false );
+    if( isConstructed() && mutex_.isConstructed() && jobs_.isConstructed() )
+    {
+        int32_t const number( (threads < THREADS_MAX) ? threads : THREADS_MAX );
+        for(int32_t i(0); i < number; i++)
+        {
+            workers_[i].bind(this);
+            api::Thread* const thread( scheduler.createThread(workers_[i]) );
+            if( thread == NULLPTR )
+            {
+                break;
+            }
+            if( !thread->execute() )
+            {
+                delete thread;
+                break;
+            }
+            threads_[threadsNumber_] = thread;
+            threadsNumber_++;
+        }
+        res = (threadsNumber_ == number) && (number > 0);
+    }
+    return res;
+}
+
+template <int32_t N>
+void DeadlineScheduler<N>::work()
+{
+    owner_ = this;
+    while( jobs_.acquire() )
+    {
+        Job job;
+        // The deadline of the idle thread is the latest one
+        if( take(job, 0x7FFFFFFFFFFFFFFFLL) )
+        {
+            dispatch(job);
+        }
+        else if( isStopping_.load() )
+        {
+            break;
+        }
+        else
+        {
+            // The job of the permit has been executed by a yielding task
+        }
+    }
+    owner_ = NULLPTR;
+}
+
+template <int32_t N>
+bool_t DeadlineScheduler<N>::take(Job& job, int64_t deadline)
+{
+    bool_t res( false );
+    static_cast<void>( mutex_.lock() );
+    if( (size_ > 0) && (heap_[0].deadline < deadline) )
+    {
+        job = heap_[0];
+        size_--;
+        // Sift the last job down from the root
+        Job const last( heap_[size_] );
+        int32_t index( 0 );
+        while( true )
+        {
+            int32_t child( index * 2 + 1 );
+            if( child >= size_ )
+            {
+                break;
+            }
+            if( ( (child + 1) < size_ ) && (heap_[child + 1].deadline < heap_[child].deadline) )
+            {
+                child++;
+            }
+            if( last.deadline <= heap_[child].deadline )
+            {
+                break;
+            }
+            heap_[index] = heap_[child];
+            index = child;
+        }
+        heap_[index] = last;
+        res = true;
+    }
+    static_cast<void>( mutex_.unlock() );
+    return res;
+}
+
+template <int32_t N>
+void DeadlineScheduler<N>::dispatch(Job const& job)
+{
+    deadline_ = job.deadline;
+    job.task->start();
+    int64_t const lateness( Clock::getTime() - job.deadline );
+    if( lateness > 0 )
+    {
+        static_cast<void>( misses_.fetchAdd(1) );
+        Listener* const listener( listener_.load() );
+        if( listener != NULLPTR )
+        {
+            listener->onMiss(*job.task, lateness);
+        }
+    }
+}
+
+template <int32_t N>
+DeadlineScheduler<N>::Worker::Worker()
+    : NonCopyable<NoAllocator>()
+    , api::Task()
+    , scheduler_( NULLPTR ) {
+}
+
+template <int32_t N>
+DeadlineScheduler<N>::Worker::~Worker()
+{
+}
+
+template <int32_t N>
+bool_t DeadlineScheduler<N>::Worker::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <int32_t N>
+void DeadlineScheduler<N>::Worker::start()
+{
+    if( scheduler_ != NULLPTR )
+    {
+        scheduler_->work();
+    }
+}
+
+template <int32_t N>
+size_t DeadlineScheduler<N>::Worker::getStackSize() const
+{
+    return 0U;
+}
+
+template <int32_t N>
+void DeadlineScheduler<N>::Worker::bind(DeadlineScheduler* scheduler)
+{
+    scheduler_ = scheduler;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_DEADLINESCHEDULER_HPP_
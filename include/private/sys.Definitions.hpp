@@ -44,6 +44,36 @@
     #define EOOS_GLOBAL_SYS_THREAD_AMOUNT (0)
 #endif
 
+#ifndef EOOS_GLOBAL_SYS_RWLOCK_AMOUNT
+    #define EOOS_GLOBAL_SYS_RWLOCK_AMOUNT (0)
+#endif
+
+#ifndef EOOS_GLOBAL_SYS_CONDITION_VARIABLE_AMOUNT
+    #define EOOS_GLOBAL_SYS_CONDITION_VARIABLE_AMOUNT (0)
+#endif
+
+#ifndef EOOS_GLOBAL_SYS_EVENT_AMOUNT
+    #define EOOS_GLOBAL_SYS_EVENT_AMOUNT (0)
+#endif
+
+/**
+ * @brief Define number of reader counters of a reader-writer lock.
+ *
+ * @note Readers on different CPUs use different counters placed in different cache lines.
+ */
+#ifndef EOOS_GLOBAL_SYS_RWLOCK_SHARDS
+    #define EOOS_GLOBAL_SYS_RWLOCK_SHARDS (16)
+#endif
+
+/**
+ * @brief Define maximum number of threads executing one range of parallel algorithms or one task graph.
+ *
+ * @note The number of threads is also limited by the number of online CPUs.
+ */
+#ifndef EOOS_GLOBAL_SYS_PARALLEL_THREADS
+    #define EOOS_GLOBAL_SYS_PARALLEL_THREADS (64)
+#endif
+
 /**
  * @brief Sets child thread's CPU affinity mask to primary thread CPU..
  *
@@ -58,4 +88,78 @@
  * #define EOOS_GLOBAL_SYS_SCHEDULER_REALTIME
  */
 
+/**
+ * @brief Creates mutexes of the default kind of the mutex manager on Linux futexes instead of POSIX mutexes.
+ *
+ * @note The definition shall be passed to the project build system through global compile definitions.
+ * #define EOOS_GLOBAL_SYS_MUTEX_FUTEX
+ */
+
+/**
+ * @brief Creates semaphores of the semaphore manager on Linux futexes instead of POSIX semaphores.
+ *
+ * @note The definition shall be passed to the project build system through global compile definitions.
+ * #define EOOS_GLOBAL_SYS_SEMAPHORE_FUTEX
+ */
+
+/**
+ * @brief Creates POSIX mutexes of the default type as error-checking ones.
+ *
+ * @note The definition is intended for debug builds.
+ * @note The definition shall be passed to the project build system through global compile definitions.
+ * #define EOOS_GLOBAL_SYS_MUTEX_ERRORCHECK
+ */
+
+/**
+ * @brief Locks all current and future pages of the process in RAM before the first task is run.
+ *
+ * @note The definition shall be passed to the project build system through global compile definitions.
+ * #define EOOS_GLOBAL_SYS_MEMORY_LOCK
+ */
+
+/**
+ * @brief Disables returning freed heap memory to the OS, and serving big allocations by separate mappings.
+ *
+ * @note The definition shall be passed to the project build system through global compile definitions.
+ * #define EOOS_GLOBAL_SYS_MEMORY_NO_TRIM
+ */
+
+/**
+ * @brief Define number of bytes of heap memory touched before the first task is run.
+ *
+ * @note A non-zero number sets the heap policy of EOOS_GLOBAL_SYS_MEMORY_NO_TRIM, as the heap reserve
+ *       is otherwise returned to the OS on freeing, and the reserve stays mapped for future allocations.
+ */
+#ifndef EOOS_GLOBAL_SYS_MEMORY_HEAP_PREFAULT
+    #define EOOS_GLOBAL_SYS_MEMORY_HEAP_PREFAULT (0)
+#endif
+
+/**
+ * @brief Define number of bytes of the primary thread stack touched before the first task is run.
+ */
+#ifndef EOOS_GLOBAL_SYS_MEMORY_STACK_PREFAULT
+    #define EOOS_GLOBAL_SYS_MEMORY_STACK_PREFAULT (0)
+#endif
+
+/**
+ * @brief Records contention of mutexes and semaphores for reports of the mutex and semaphore managers.
+ *
+ * @note The definition shall be passed to the project build system through global compile definitions.
+ * #define EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+ */
+
+/**
+ * @brief Define maximum number of threads recording contention.
+ */
+#ifndef EOOS_GLOBAL_SYS_CONTENTION_THREADS
+    #define EOOS_GLOBAL_SYS_CONTENTION_THREADS (32)
+#endif
+
+/**
+ * @brief Define maximum number of objects a thread records contention of.
+ */
+#ifndef EOOS_GLOBAL_SYS_CONTENTION_RECORDS
+    #define EOOS_GLOBAL_SYS_CONTENTION_RECORDS (32)
+#endif
+
 #endif // SYS_DEFINITIONS_HPP_
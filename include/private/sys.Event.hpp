@@ -0,0 +1,326 @@
+/**
+ * @file      sys.Event.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EVENT_HPP_
+#define SYS_EVENT_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Atomic.hpp"
+#include "sys.Futex.hpp"
+#include "sys.Clock.hpp"
+#include "sys.Backoff.hpp"
+#include "sys.BusyPoll.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Event
+ * @brief Event class on a Linux futex.
+ *
+ * An auto-reset event releases one waiting thread per setting and is reset by the thread released,
+ * and a manual-reset event releases all waiting threads and stays set until it is reset. The event
+ * word keeps the flag and a generation incremented by each setting, thus a setting releases
+ * the threads waiting for a manual-reset event even if the event is reset before they wake up.
+ * Waiting threads are counted, thus a setting enters the kernel only if there are sleeping threads.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class Event : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @enum Mode
+     * @brief Reset mode of an event.
+     */
+    enum Mode
+    {
+        MODE_AUTO_RESET   = 0, ///< @brief Reset by the thread released.
+        MODE_MANUAL_RESET = 1  ///< @brief Reset by the reset() function.
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param mode  The reset mode.
+     * @param isSet True to create the event set.
+     */
+    explicit Event(Mode mode, bool_t isSet = false);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Event();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Waits for the event to be set.
+     *
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the event has been set, false if the timeout has expired or an error occurred.
+     */
+    bool_t wait(int64_t timeout = Clock::TIMEOUT_INFINITE);
+
+    /**
+     * @brief Sets the event.
+     *
+     * @return True if the event is set.
+     */
+    bool_t set();
+
+    /**
+     * @brief Resets the event.
+     *
+     * @return True if the event is reset.
+     */
+    bool_t reset();
+
+    /**
+     * @brief Tests if the event is set.
+     *
+     * @return True if the event is set.
+     */
+    bool_t isSet() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Flag of the event word meaning the event is set.
+     */
+    static const int32_t FLAG_SET = 1;
+
+    /**
+     * @brief Number of spin iterations before sleeping.
+     */
+    static const int32_t SPINS = 100;
+
+    /**
+     * @brief Number of threads meaning all threads.
+     */
+    static const int32_t ALL = 0x7FFFFFFF;
+
+    /**
+     * @brief Takes the event for a waiting thread.
+     *
+     * @param word    The event word loaded, which is updated on a failed auto-reset.
+     * @param initial The event word the thread has started waiting with.
+     * @return True if the thread is released.
+     */
+    bool_t take(int32_t& word, int32_t initial);
+
+    /**
+     * @brief Waits for the event which is not set.
+     *
+     * @param initial  The event word the thread has started waiting with.
+     * @param deadline Absolute CLOCK_MONOTONIC deadline in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the thread is released before the deadline.
+     */
+    bool_t waitContended(int32_t initial, int64_t deadline);
+
+    /**
+     * @brief Returns the event word set of the next generation.
+     *
+     * @param word The event word not set.
+     * @return The event word set.
+     */
+    static int32_t getSetWord(int32_t word);
+
+    /**
+     * @brief The reset mode.
+     */
+    Mode mode_;
+
+    /**
+     * @brief The event word of the flag and the generation.
+     */
+    Atomic<int32_t> word_;
+
+    /**
+     * @brief Number of sleeping threads.
+     */
+    Atomic<int32_t> waiters_;
+
+};
+
+template <class A>
+Event<A>::Event(Mode const mode, bool_t const isSet)
+    : NonCopyable<A>()
+    , mode_( mode )
+    , word_( isSet ? FLAG_SET : 0 )
+    , waiters_( 0 ) {
+    bool_t const isConstructed( (mode == MODE_AUTO_RESET) || (mode == MODE_MANUAL_RESET) );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+Event<A>::~Event()
+{
+}
+
+template <class A>
+bool_t Event<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t Event<A>::wait(int64_t const timeout)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        int32_t const initial( word_.load(Atomic<int32_t>::ORDER_ACQUIRE) );
+        int32_t word( initial );
+        res = take(word, initial);
+        if( !res )
+        {
+            res = waitContended(initial, (timeout >= 0) ? (Clock::getTime() + timeout) : Clock::TIMEOUT_INFINITE);
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t Event<A>::set()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        bool_t isChanged( false );
+        int32_t word( word_.load(Atomic<int32_t>::ORDER_RELAXED) );
+        while( !isChanged && ( (word & FLAG_SET) == 0 ) )
+        {
+            isChanged = word_.compareExchange(word, getSetWord(word));
+        }
+        // Setting a set event releases no more threads
+        if( isChanged && (waiters_.load() > 0) )
+        {
+            int32_t const number( (mode_ == MODE_MANUAL_RESET) ? ALL : 1 );
+            static_cast<void>( Futex::wake(word_.getAddress(), number) );
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t Event<A>::reset()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        bool_t isChanged( false );
+        int32_t word( word_.load(Atomic<int32_t>::ORDER_RELAXED) );
+        while( !isChanged && ( (word & FLAG_SET) != 0 ) )
+        {
+            isChanged = word_.compareExchange(word, word & ~FLAG_SET, Atomic<int32_t>::ORDER_RELAXED);
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t Event<A>::isSet() const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = (word_.load(Atomic<int32_t>::ORDER_ACQUIRE) & FLAG_SET) != 0;
+    }
+    return res;
+}
+
+template <class A>
+bool_t Event<A>::take(int32_t& word, int32_t const initial)
+{
+    bool_t res( false );
+    if( mode_ == MODE_MANUAL_RESET )
+    {
+        // A change of the word not set means a setting of the next generation
+        res = ( (word & FLAG_SET) != 0 ) || (word != initial);
+    }
+    else
+    {
+        while( !res && ( (word & FLAG_SET) != 0 ) )
+        {
+            res = word_.compareExchange(word, word & ~FLAG_SET, Atomic<int32_t>::ORDER_ACQUIRE);
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t Event<A>::waitContended(int32_t const initial, int64_t const deadline)
+{
+    bool_t const isBusyPoll( BusyPoll::isEnabled() );
+    bool_t isReleased( false );
+    bool_t isExpired( false );
+    for(int32_t count(0); !isReleased && !isExpired && ( isBusyPoll || (count < SPINS) ); count += (count < SPINS) ? 1 : 0)
+    {
+        Backoff::relax();
+        int32_t word( word_.load(Atomic<int32_t>::ORDER_ACQUIRE) );
+        isReleased = take(word, initial);
+        if( !isReleased && (deadline >= 0) )
+        {
+            isExpired = Clock::getTime() >= deadline;
+        }
+    }
+    if( !isReleased && !isExpired )
+    {
+        // Count the thread before the word is loaded, so a setting after the load wakes it up
+        static_cast<void>( waiters_.fetchAdd(1) );
+        int32_t word( word_.load() );
+        isReleased = take(word, initial);
+        while( !isReleased && !isExpired )
+        {
+            if( deadline < 0 )
+            {
+                static_cast<void>( Futex::wait(word_.getAddress(), word) );
+            }
+            else
+            {
+                int64_t const timeout( deadline - Clock::getTime() );
+                isExpired = (timeout <= 0) || !Futex::wait(word_.getAddress(), word, timeout);
+            }
+            // The event may have been set on expiry
+            word = word_.load();
+            isReleased = take(word, initial);
+        }
+        static_cast<void>( waiters_.fetchSub(1) );
+        if( !isReleased && (mode_ == MODE_AUTO_RESET) && ( (word_.load() & FLAG_SET) != 0 ) && (waiters_.load() > 0) )
+        {
+            // A setting may have woken this thread up on expiry, pass the wake on
+            static_cast<void>( Futex::wake(word_.getAddress(), 1) );
+        }
+    }
+    return isReleased;
+}
+
+template <class A>
+int32_t Event<A>::getSetWord(int32_t const word)
+{
+    // The generation is incremented in unsigned arithmetic to wrap around
+    uint32_t const next( static_cast<uint32_t>(word) + 2U );
+    return static_cast<int32_t>( next | static_cast<uint32_t>(FLAG_SET) );
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EVENT_HPP_
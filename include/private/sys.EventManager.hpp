@@ -0,0 +1,138 @@
+/**
+ * @file      sys.EventManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EVENTMANAGER_HPP_
+#define SYS_EVENTMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Event.hpp"
+#include "sys.LockFreePool.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class EventManager.
+ * @brief Event sub-system manager.
+ */
+class EventManager : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+    typedef Event<EventManager> Resource;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    EventManager();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~EventManager();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Creates a new event resource.
+     *
+     * @param mode  The reset mode.
+     * @param isSet True to create the event set.
+     * @return A new event resource, or NULLPTR if an error has been occurred.
+     */
+    Event<EventManager>* create(Event<EventManager>::Mode mode, bool_t isSet);
+
+    /**
+     * @brief Removes an event resource.
+     *
+     * @note Threads shall not wait for the event being removed.
+     *
+     * @param event The event resource created by the create() function, or NULLPTR.
+     */
+    void remove(Event<EventManager>* event);
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees allocated memory.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes the allocator with heap for resource allocation.
+     *
+     * @param resource Heap for resource allocation.
+     * @return True if initialized.
+     */
+    static bool_t initialize(api::Heap* resource);
+
+    /**
+     * @brief Initializes the allocator.
+     */
+    static void deinitialize();
+
+    /**
+     * @struct ResourcePool
+     * @brief Resource memory pool.
+     */
+    struct ResourcePool
+    {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        ResourcePool();
+
+        /**
+         * @brief Event memory allocator.
+         */
+        LockFreePool<Resource,EOOS_GLOBAL_SYS_EVENT_AMOUNT> memory;
+
+    };
+
+    /**
+     * @brief Heap for resource allocation.
+     */
+    static api::Heap* resource_;
+
+    /**
+     * @brief Resource memory pool.
+     */
+    ResourcePool pool_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EVENTMANAGER_HPP_
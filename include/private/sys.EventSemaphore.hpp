@@ -0,0 +1,433 @@
+/**
+ * @file      sys.EventSemaphore.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EVENTSEMAPHORE_HPP_
+#define SYS_EVENTSEMAPHORE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.CountingSemaphore.hpp"
+#include "sys.Clock.hpp"
+#include "sys.Contention.hpp"
+#include "sys.Backoff.hpp"
+#include "sys.BusyPoll.hpp"
+#include "sys.FutexMutex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class EventSemaphore
+ * @brief Semaphore class on a Linux event file descriptor.
+ *
+ * The number of permits is the counter of an eventfd in the semaphore mode, which is readable
+ * while permits are available. Thus the descriptor is waited for by poll, select or epoll together
+ * with other descriptors, and a thread of an event loop takes a permit by the tryAcquire() function
+ * when the descriptor is reported readable. The descriptor is non-blocking, and a blocking acquisition
+ * polls the descriptor itself.
+ *
+ * @note Other threads may take the permit between the descriptor is reported readable and
+ *       the tryAcquire() call, which fails then.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class EventSemaphore : public NonCopyable<A>, public CountingSemaphore
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param permits The initial number of permits available.
+     */
+    explicit EventSemaphore(int32_t permits);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~EventSemaphore();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Semaphore::acquire()
+     */
+    virtual bool_t acquire();
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(int64_t)
+     */
+    virtual bool_t acquire(int64_t timeout);
+
+    /**
+     * @brief Acquires a number of permits waiting for a limited time.
+     *
+     * @note The permits are taken one by one, and acquisitions of a number of permits are serialized,
+     *       thus two of them do not deadlock each holding a part of permits.
+     *
+     * @param permits The number of permits.
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the permits have been acquired, false if the timeout has expired or an error occurred.
+     */
+    virtual bool_t acquire(int32_t permits, int64_t timeout);
+
+    /**
+     * @brief Acquires a number of permits if they are available.
+     *
+     * @note The acquisition of more than one permit fails if another acquisition of a number is in progress.
+     *
+     * @param permits The number of permits.
+     * @return True if the permits have been acquired.
+     */
+    virtual bool_t tryAcquire(int32_t permits);
+
+    /**
+     * @copydoc eoos::api::Semaphore::release()
+     */
+    virtual bool_t release();
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::release(int32_t)
+     */
+    virtual bool_t release(int32_t permits);
+
+    /**
+     * @brief Returns the file descriptor, which is readable while permits are available.
+     *
+     * @note The descriptor is owned by the semaphore, and shall not be read, written or closed.
+     *
+     * @return The file descriptor, or -1 if the semaphore is not constructed.
+     */
+    int_t getDescriptor() const;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Acquires one permit.
+     *
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @param site    The call site.
+     * @return True if the permit has been acquired before the timeout.
+     */
+    bool_t acquirePermit(int64_t timeout, void const* site);
+
+    /**
+     * @brief Takes one permit if available.
+     *
+     * @return True if the permit has been taken.
+     */
+    bool_t take();
+
+    /**
+     * @brief Acquires one permit which is not available.
+     *
+     * @param deadline Absolute CLOCK_MONOTONIC deadline in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the permit has been acquired before the deadline.
+     */
+    bool_t acquireContended(int64_t deadline);
+
+    /**
+     * @brief Waits for the descriptor to be readable.
+     *
+     * @param deadline Absolute CLOCK_MONOTONIC deadline in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return False if the deadline has expired or an error occurred.
+     */
+    bool_t poll(int64_t deadline) const;
+
+    /**
+     * @brief Records an acquisition of the semaphore to the contention profiler.
+     *
+     * @param start       Time the wait has started at.
+     * @param isContended True if the permit has not been acquired at once.
+     * @param site        The call site.
+     */
+    void onAcquire(int64_t start, bool_t isContended, void const* site) const;
+
+    /**
+     * @brief The event file descriptor.
+     */
+    int_t fd_;
+
+    /**
+     * @brief Mutex serializing acquisitions of a number of permits.
+     */
+    FutexMutex<NoAllocator> batch_;
+
+};
+
+template <class A>
+EventSemaphore<A>::EventSemaphore(int32_t const permits)
+    : NonCopyable<A>()
+    , CountingSemaphore()
+    , fd_( (permits >= 0) ? ::eventfd(static_cast<uint_t>(permits), EFD_SEMAPHORE | EFD_NONBLOCK | EFD_CLOEXEC) : -1 )
+    , batch_() {
+    bool_t const isConstructed( fd_ >= 0 );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+EventSemaphore<A>::~EventSemaphore()
+{
+    #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    Contention::onDestroy(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE);
+    #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    if( fd_ >= 0 )
+    {
+        static_cast<void>( ::close(fd_) );
+    }
+}
+
+template <class A>
+bool_t EventSemaphore<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t EventSemaphore<A>::acquire()
+{
+    return acquirePermit(Clock::TIMEOUT_INFINITE, __builtin_return_address(0));
+}
+
+template <class A>
+bool_t EventSemaphore<A>::acquire(int64_t const timeout)
+{
+    return acquirePermit(timeout, __builtin_return_address(0));
+}
+
+template <class A>
+bool_t EventSemaphore<A>::acquire(int32_t const permits, int64_t const timeout)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits > 0) )
+    {
+        int64_t const start( Clock::getTime() );
+        int64_t const deadline( (timeout >= 0) ? (start + timeout) : Clock::TIMEOUT_INFINITE );
+        bool_t isContended( false );
+        if( batch_.lock(timeout) )
+        {
+            int32_t taken( 0 );
+            res = true;
+            while( res && (taken < permits) )
+            {
+                res = take();
+                if( !res )
+                {
+                    isContended = true;
+                    res = acquireContended(deadline);
+                }
+                if( res )
+                {
+                    taken++;
+                }
+            }
+            if( !res && (taken > 0) )
+            {
+                static_cast<void>( release(taken) );
+            }
+            static_cast<void>( batch_.unlock() );
+        }
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        // The permits are recorded as one acquisition
+        if( res )
+        {
+            onAcquire(start, isContended, __builtin_return_address(0));
+        }
+        else
+        {
+            Contention::onFail(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, __builtin_return_address(0));
+        }
+        #else
+        static_cast<void>( isContended );
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t EventSemaphore<A>::tryAcquire(int32_t const permits)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits > 0) )
+    {
+        if( permits == 1 )
+        {
+            res = take();
+        }
+        else if( batch_.tryLock() )
+        {
+            // Serialized with other acquisitions of a number, which do not roll back permits taken meanwhile
+            int32_t taken( 0 );
+            while( (taken < permits) && take() )
+            {
+                taken++;
+            }
+            res = taken == permits;
+            if( !res && (taken > 0) )
+            {
+                static_cast<void>( release(taken) );
+            }
+            static_cast<void>( batch_.unlock() );
+        }
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( res )
+        {
+            onAcquire(0, false, __builtin_return_address(0));
+        }
+        else
+        {
+            Contention::onFail(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, __builtin_return_address(0));
+        }
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t EventSemaphore<A>::release()
+{
+    return release(1);
+}
+
+template <class A>
+bool_t EventSemaphore<A>::release(int32_t const permits)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits > 0) )
+    {
+        uint64_t const value( static_cast<uint64_t>(permits) );
+        ::ssize_t size( -1 );
+        do
+        {
+            size = ::write(fd_, &value, sizeof(value));
+        }
+        while( (size < 0) && (errno == EINTR) );
+        res = size == static_cast< ::ssize_t >( sizeof(value) );
+    }
+    return res;
+}
+
+template <class A>
+int_t EventSemaphore<A>::getDescriptor() const
+{
+    return isConstructed() ? fd_ : -1;
+}
+
+template <class A>
+bool_t EventSemaphore<A>::acquirePermit(int64_t const timeout, void const* const site)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = take();
+        bool_t const isContended( !res );
+        int64_t const start( isContended ? Clock::getTime() : 0 );
+        if( isContended )
+        {
+            res = acquireContended( (timeout >= 0) ? (start + timeout) : Clock::TIMEOUT_INFINITE );
+        }
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( res )
+        {
+            onAcquire(start, isContended, site);
+        }
+        else
+        {
+            Contention::onFail(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, site);
+        }
+        #else
+        static_cast<void>( site );
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t EventSemaphore<A>::take()
+{
+    // A read of the descriptor in the semaphore mode decrements the counter by one
+    uint64_t value( 0U );
+    ::ssize_t const size( ::read(fd_, &value, sizeof(value)) );
+    return size == static_cast< ::ssize_t >( sizeof(value) );
+}
+
+template <class A>
+bool_t EventSemaphore<A>::acquireContended(int64_t const deadline)
+{
+    bool_t const isBusyPoll( BusyPoll::isEnabled() );
+    bool_t isAcquired( false );
+    bool_t isExpired( false );
+    while( !isAcquired && !isExpired )
+    {
+        if( isBusyPoll )
+        {
+            Backoff::relax();
+        }
+        else
+        {
+            isExpired = !poll(deadline);
+        }
+        if( !isExpired )
+        {
+            // Another thread may have taken the permit the descriptor has been readable for
+            isAcquired = take();
+            if( !isAcquired && (deadline >= 0) )
+            {
+                isExpired = Clock::getTime() >= deadline;
+            }
+        }
+    }
+    return isAcquired;
+}
+
+template <class A>
+bool_t EventSemaphore<A>::poll(int64_t const deadline) const
+{
+    bool_t res( true );
+    ::pollfd event;
+    event.fd = fd_;
+    event.events = POLLIN;
+    event.revents = 0;
+    int_t ready( -1 );
+    if( deadline < 0 )
+    {
+        ready = ::ppoll(&event, 1U, NULLPTR, NULLPTR);
+    }
+    else
+    {
+        int64_t const timeout( deadline - Clock::getTime() );
+        ::timespec time;
+        time.tv_sec = (timeout > 0) ? static_cast< ::time_t >(timeout / 1000000000LL) : 0;
+        time.tv_nsec = (timeout > 0) ? static_cast<long>(timeout % 1000000000LL) : 0L;
+        ready = ::ppoll(&event, 1U, &time, NULLPTR);
+    }
+    if( (ready == 0) || ( (ready < 0) && (errno != EINTR) ) )
+    {
+        res = false;
+    }
+    return res;
+}
+
+template <class A>
+void EventSemaphore<A>::onAcquire(int64_t const start, bool_t const isContended, void const* const site) const
+{
+    int64_t const wait( isContended ? (Clock::getTime() - start) : 0 );
+    Contention::onAcquire(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, wait, isContended, site);
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EVENTSEMAPHORE_HPP_
@@ -0,0 +1,511 @@
+/**
+ * @file      sys.FairSemaphore.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_FAIRSEMAPHORE_HPP_
+#define SYS_FAIRSEMAPHORE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.CountingSemaphore.hpp"
+#include "sys.Spinlock.hpp"
+#include "sys.Atomic.hpp"
+#include "sys.Futex.hpp"
+#include "sys.Clock.hpp"
+#include "sys.Contention.hpp"
+#include "sys.Backoff.hpp"
+#include "sys.BusyPoll.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class FairSemaphore
+ * @brief Semaphore class granting permits in order of arrival.
+ *
+ * Threads which cannot acquire permits at once queue in order of arrival, and a release hands
+ * the permits off to the threads at the queue head directly, thus a thread arriving later does not
+ * acquire permits before threads queued earlier. Each queued thread waits on a word of its own,
+ * thus a release wakes up only sleeping threads the permits are handed off to.
+ *
+ * @note A thread at the queue head waiting for more permits than available holds threads behind it.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class FairSemaphore : public NonCopyable<A>, public CountingSemaphore
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param permits The initial number of permits available.
+     */
+    explicit FairSemaphore(int32_t permits);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~FairSemaphore();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Semaphore::acquire()
+     */
+    virtual bool_t acquire();
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(int64_t)
+     */
+    virtual bool_t acquire(int64_t timeout);
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(int32_t,int64_t)
+     */
+    virtual bool_t acquire(int32_t permits, int64_t timeout);
+
+    /**
+     * @brief Acquires a number of permits at once if they are available and no threads are queued.
+     *
+     * @param permits The number of permits.
+     * @return True if the permits have been acquired.
+     */
+    virtual bool_t tryAcquire(int32_t permits);
+
+    /**
+     * @copydoc eoos::api::Semaphore::release()
+     */
+    virtual bool_t release();
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::release(int32_t)
+     */
+    virtual bool_t release(int32_t permits);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Number of spin iterations before sleeping.
+     */
+    static const int32_t SPINS = 100;
+
+    /**
+     * @enum State
+     * @brief State of a queued thread.
+     */
+    enum State
+    {
+        STATE_WAITING = 0, ///< @brief Waiting for permits.
+        STATE_PARKED  = 1, ///< @brief Sleeping for permits.
+        STATE_GRANTED = 2  ///< @brief Permits are handed off.
+    };
+
+    /**
+     * @struct Node
+     * @brief Queued thread on its stack.
+     */
+    struct Node
+    {
+        /**
+         * @brief Constructor.
+         *
+         * @param number Number of permits the thread waits for.
+         */
+        explicit Node(int32_t number);
+
+        /**
+         * @brief Next queued thread.
+         */
+        Node* next;
+
+        /**
+         * @brief Number of permits the thread waits for.
+         */
+        int32_t permits;
+
+        /**
+         * @brief The thread is in the queue, which is changed with the guard locked only.
+         */
+        bool_t isQueued;
+
+        /**
+         * @brief The state word the thread waits on.
+         */
+        Atomic<int32_t> state;
+    };
+
+    /**
+     * @brief Acquires a number of permits.
+     *
+     * @param permits The number of permits.
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @param site    The call site.
+     * @return True if the permits have been acquired before the timeout.
+     */
+    bool_t acquirePermits(int32_t permits, int64_t timeout, void const* site);
+
+    /**
+     * @brief Waits for permits handed off to a queued thread.
+     *
+     * @param node     The queued thread.
+     * @param deadline Absolute CLOCK_MONOTONIC deadline in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the permits have been handed off before the deadline.
+     */
+    bool_t wait(Node& node, int64_t deadline);
+
+    /**
+     * @brief Removes queued threads which available permits are enough for.
+     *
+     * @note The function shall be called with the guard locked.
+     *
+     * @return Chain of removed threads to hand off the permits to.
+     */
+    Node* grant();
+
+    /**
+     * @brief Hands permits off to threads removed from the queue.
+     *
+     * @param chain Chain of removed threads.
+     */
+    static void handOff(Node* chain);
+
+    /**
+     * @brief Records an acquisition of the semaphore to the contention profiler.
+     *
+     * @param start       Time the wait has started at.
+     * @param isContended True if the permit has not been acquired at once.
+     * @param site        The call site.
+     */
+    void onAcquire(int64_t start, bool_t isContended, void const* site) const;
+
+    /**
+     * @brief Guard of the permits and the queue.
+     */
+    Spinlock<NoAllocator> guard_;
+
+    /**
+     * @brief Number of permits available.
+     */
+    int32_t permits_;
+
+    /**
+     * @brief Head of the queue.
+     */
+    Node* head_;
+
+    /**
+     * @brief Tail of the queue.
+     */
+    Node* tail_;
+
+};
+
+template <class A>
+FairSemaphore<A>::Node::Node(int32_t const number)
+    : next( NULLPTR )
+    , permits( number )
+    , isQueued( false )
+    , state( STATE_WAITING ) {
+}
+
+template <class A>
+FairSemaphore<A>::FairSemaphore(int32_t const permits)
+    : NonCopyable<A>()
+    , CountingSemaphore()
+    , guard_()
+    , permits_( permits )
+    , head_( NULLPTR )
+    , tail_( NULLPTR ) {
+    bool_t const isConstructed( (permits >= 0) && guard_.isConstructed() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+FairSemaphore<A>::~FairSemaphore()
+{
+    #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    Contention::onDestroy(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE);
+    #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+}
+
+template <class A>
+bool_t FairSemaphore<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t FairSemaphore<A>::acquire()
+{
+    return acquirePermits(1, Clock::TIMEOUT_INFINITE, __builtin_return_address(0));
+}
+
+template <class A>
+bool_t FairSemaphore<A>::acquire(int64_t const timeout)
+{
+    return acquirePermits(1, timeout, __builtin_return_address(0));
+}
+
+template <class A>
+bool_t FairSemaphore<A>::acquire(int32_t const permits, int64_t const timeout)
+{
+    return acquirePermits(permits, timeout, __builtin_return_address(0));
+}
+
+template <class A>
+bool_t FairSemaphore<A>::tryAcquire(int32_t const permits)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits > 0) )
+    {
+        static_cast<void>( guard_.lock() );
+        if( (head_ == NULLPTR) && (permits_ >= permits) )
+        {
+            permits_ -= permits;
+            res = true;
+        }
+        static_cast<void>( guard_.unlock() );
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( res )
+        {
+            onAcquire(0, false, __builtin_return_address(0));
+        }
+        else
+        {
+            Contention::onFail(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, __builtin_return_address(0));
+        }
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t FairSemaphore<A>::release()
+{
+    return release(1);
+}
+
+template <class A>
+bool_t FairSemaphore<A>::release(int32_t const permits)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits > 0) )
+    {
+        static_cast<void>( guard_.lock() );
+        permits_ += permits;
+        Node* const chain( grant() );
+        static_cast<void>( guard_.unlock() );
+        handOff(chain);
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t FairSemaphore<A>::acquirePermits(int32_t const permits, int64_t const timeout, void const* const site)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits > 0) )
+    {
+        Node node(permits);
+        static_cast<void>( guard_.lock() );
+        // Threads arriving later do not take permits before queued ones
+        if( (head_ == NULLPTR) && (permits_ >= permits) )
+        {
+            permits_ -= permits;
+            res = true;
+        }
+        else if( tail_ == NULLPTR )
+        {
+            node.isQueued = true;
+            head_ = &node;
+            tail_ = &node;
+        }
+        else
+        {
+            node.isQueued = true;
+            tail_->next = &node;
+            tail_ = &node;
+        }
+        static_cast<void>( guard_.unlock() );
+        bool_t const isContended( !res );
+        int64_t const start( isContended ? Clock::getTime() : 0 );
+        if( isContended )
+        {
+            res = wait(node, (timeout >= 0) ? (start + timeout) : Clock::TIMEOUT_INFINITE);
+        }
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( res )
+        {
+            onAcquire(start, isContended, site);
+        }
+        else
+        {
+            Contention::onFail(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, site);
+        }
+        #else
+        static_cast<void>( site );
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t FairSemaphore<A>::wait(Node& node, int64_t const deadline)
+{
+    bool_t const isBusyPoll( BusyPoll::isEnabled() );
+    bool_t isGranted( false );
+    bool_t isExpired( false );
+    int32_t count( 0 );
+    while( !isGranted && !isExpired )
+    {
+        if( node.state.load(Atomic<int32_t>::ORDER_ACQUIRE) == STATE_GRANTED )
+        {
+            isGranted = true;
+        }
+        else if( isBusyPoll || (count < SPINS) )
+        {
+            Backoff::relax();
+            if( count < SPINS )
+            {
+                count++;
+            }
+            if( deadline >= 0 )
+            {
+                isExpired = Clock::getTime() >= deadline;
+            }
+        }
+        else
+        {
+            // Announce the sleep, so a hand-off to a spinning thread does not enter the kernel
+            int32_t expected( STATE_WAITING );
+            bool_t const isParked( node.state.compareExchange(expected, STATE_PARKED, Atomic<int32_t>::ORDER_ACQUIRE) || (expected == STATE_PARKED) );
+            if( !isParked )
+            {
+                isGranted = true;
+            }
+            else if( deadline < 0 )
+            {
+                static_cast<void>( Futex::wait(node.state.getAddress(), STATE_PARKED) );
+            }
+            else
+            {
+                int64_t const timeout( deadline - Clock::getTime() );
+                isExpired = (timeout <= 0) || !Futex::wait(node.state.getAddress(), STATE_PARKED, timeout);
+            }
+        }
+    }
+    if( isExpired )
+    {
+        static_cast<void>( guard_.lock() );
+        // The permits may have been granted meanwhile, otherwise the thread leaves the queue
+        isGranted = !node.isQueued;
+        Node* chain( NULLPTR );
+        if( !isGranted )
+        {
+            Node* prev( NULLPTR );
+            Node* curr( head_ );
+            while( curr != &node )
+            {
+                prev = curr;
+                curr = curr->next;
+            }
+            if( prev == NULLPTR )
+            {
+                head_ = node.next;
+            }
+            else
+            {
+                prev->next = node.next;
+            }
+            if( tail_ == &node )
+            {
+                tail_ = prev;
+            }
+            // The thread may have held threads behind it which permits are enough for
+            chain = grant();
+        }
+        static_cast<void>( guard_.unlock() );
+        handOff(chain);
+        if( isGranted )
+        {
+            // The node shall live until the granting thread has handed the permits off to it
+            int32_t expected( STATE_WAITING );
+            static_cast<void>( node.state.compareExchange(expected, STATE_PARKED, Atomic<int32_t>::ORDER_ACQUIRE) );
+            while( node.state.load(Atomic<int32_t>::ORDER_ACQUIRE) != STATE_GRANTED )
+            {
+                static_cast<void>( Futex::wait(node.state.getAddress(), STATE_PARKED) );
+            }
+        }
+    }
+    return isGranted;
+}
+
+template <class A>
+typename FairSemaphore<A>::Node* FairSemaphore<A>::grant()
+{
+    Node* chain( NULLPTR );
+    Node* last( NULLPTR );
+    while( (head_ != NULLPTR) && (permits_ >= head_->permits) )
+    {
+        Node* const node( head_ );
+        permits_ -= node->permits;
+        head_ = node->next;
+        node->next = NULLPTR;
+        node->isQueued = false;
+        if( last == NULLPTR )
+        {
+            chain = node;
+        }
+        else
+        {
+            last->next = node;
+        }
+        last = node;
+    }
+    if( head_ == NULLPTR )
+    {
+        tail_ = NULLPTR;
+    }
+    return chain;
+}
+
+template <class A>
+void FairSemaphore<A>::handOff(Node* chain)
+{
+    while( chain != NULLPTR )
+    {
+        // The node is on the stack of its thread, which may return once the state is granted
+        Node* const next( chain->next );
+        int32_t* const word( chain->state.getAddress() );
+        if( chain->state.exchange(STATE_GRANTED, Atomic<int32_t>::ORDER_ACQ_REL) == STATE_PARKED )
+        {
+            static_cast<void>( Futex::wake(word, 1) );
+        }
+        chain = next;
+    }
+}
+
+template <class A>
+void FairSemaphore<A>::onAcquire(int64_t const start, bool_t const isContended, void const* const site) const
+{
+    int64_t const wait( isContended ? (Clock::getTime() - start) : 0 );
+    Contention::onAcquire(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, wait, isContended, site);
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_FAIRSEMAPHORE_HPP_
@@ -0,0 +1,127 @@
+/**
+ * @file      sys.Futex.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_FUTEX_HPP_
+#define SYS_FUTEX_HPP_
+
+#include "sys.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Futex
+ * @brief Linux fast user-space mutex calls on 32-bit words private to the process.
+ */
+class Futex
+{
+
+public:
+
+    /**
+     * @brief Infinite timeout.
+     */
+    static const int64_t TIMEOUT_INFINITE = -1;
+
+    /**
+     * @brief Waits until a word is woken up if the word holds an expected value.
+     *
+     * @param addr     The word address.
+     * @param expected The expected value.
+     * @param timeout  Relative timeout in nanoseconds, or TIMEOUT_INFINITE.
+     * @return False if the timeout has expired or an error occurred, otherwise true
+     *         even if the word does not hold the expected value or the wait is spurious.
+     */
+    static bool_t wait(int32_t* addr, int32_t expected, int64_t timeout = TIMEOUT_INFINITE);
+
+    /**
+     * @brief Wakes up threads waiting on a word.
+     *
+     * @param addr   The word address.
+     * @param number Maximum number of threads to wake up.
+     * @return Number of threads woken up.
+     */
+    static int32_t wake(int32_t* addr, int32_t number);
+
+    /**
+     * @brief Wakes up threads waiting on a word and moves the rest to wait on another word.
+     *
+     * @param addr     The word address.
+     * @param expected The value the word is expected to hold.
+     * @param number   Maximum number of threads to wake up.
+     * @param target   The other word address.
+     * @return Number of threads woken up and moved, or -1 if the word does not hold
+     *         the expected value or an error occurred.
+     */
+    static int32_t requeue(int32_t* addr, int32_t expected, int32_t number, int32_t* target);
+
+    /**
+     * @brief Waits until one of words is woken up if all the words hold their expected values.
+     *
+     * The words are waited for by one futex_waitv call. If the kernel does not provide the call,
+     * the first word is waited for in slices of POLL_SLICE nanoseconds and the others are checked
+     * between the slices, thus a wake not changing the value of a word is not noticed.
+     *
+     * @param addrs    Array of the word addresses.
+     * @param expected Array of the expected values.
+     * @param number   Number of the words not more than WAIT_ANY_MAX.
+     * @param timeout  Relative timeout in nanoseconds, or TIMEOUT_INFINITE.
+     * @return Index of a word woken up or not holding its expected value,
+     *         or -1 if the timeout has expired or an error occurred.
+     */
+    static int32_t waitAny(int32_t* const* addrs, int32_t const* expected, int32_t number, int64_t timeout = TIMEOUT_INFINITE);
+
+    /**
+     * @brief Maximum number of words waited for at once.
+     */
+    static const int32_t WAIT_ANY_MAX = 128;
+
+private:
+
+    /**
+     * @brief Time of waiting for the first word between checks of words without futex_waitv.
+     */
+    static const int64_t POLL_SLICE = 1000000;
+
+    /**
+     * @brief Returns index of a word not holding its expected value.
+     *
+     * @param addrs    Array of the word addresses.
+     * @param expected Array of the expected values.
+     * @param number   Number of the words.
+     * @return Index of the word, or -1 if all the words hold their expected values.
+     */
+    static int32_t findChanged(int32_t* const* addrs, int32_t const* expected, int32_t number);
+
+    /**
+     * @brief Waits until one of words is woken up by one futex_waitv call.
+     *
+     * @param addrs    Array of the word addresses.
+     * @param expected Array of the expected values.
+     * @param number   Number of the words.
+     * @param deadline Absolute CLOCK_MONOTONIC deadline in nanoseconds, or TIMEOUT_INFINITE.
+     * @param index    Index of a word woken up or not holding its expected value, or -1.
+     * @return False if the kernel does not provide the call.
+     */
+    static bool_t waitVector(int32_t* const* addrs, int32_t const* expected, int32_t number, int64_t deadline, int32_t& index);
+
+    /**
+     * @brief Waits until one of words is changed checking the words between waits for the first word.
+     *
+     * @param addrs    Array of the word addresses.
+     * @param expected Array of the expected values.
+     * @param number   Number of the words.
+     * @param deadline Absolute CLOCK_MONOTONIC deadline in nanoseconds, or TIMEOUT_INFINITE.
+     * @return Index of a word woken up or not holding its expected value, or -1 if the deadline has expired.
+     */
+    static int32_t waitPolled(int32_t* const* addrs, int32_t const* expected, int32_t number, int64_t deadline);
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_FUTEX_HPP_
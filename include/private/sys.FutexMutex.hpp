@@ -0,0 +1,390 @@
+/**
+ * @file      sys.FutexMutex.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_FUTEXMUTEX_HPP_
+#define SYS_FUTEXMUTEX_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.ConditionMutex.hpp"
+#include "sys.MutexAttributes.hpp"
+#include "sys.Atomic.hpp"
+#include "sys.Futex.hpp"
+#include "sys.Clock.hpp"
+#include "sys.Contention.hpp"
+#include "sys.Backoff.hpp"
+#include "sys.BusyPoll.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class FutexMutex.
+ * @brief Mutex class on a Linux futex.
+ *
+ * The mutex is one 32-bit word. An uncontended lock and unlock is one atomic instruction each.
+ * A contended lock spins for a number of iterations adapted to recent lock hold times, and only
+ * then sleeps in the kernel. An unlock enters the kernel only if there are sleeping threads.
+ *
+ * @note The mutex type attribute is not applicable, and the mutex does not check errors.
+ *       The mutex is not constructed with a priority protocol, as the owner is not known to the kernel.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class FutexMutex : public NonCopyable<A>, public ConditionMutex
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    FutexMutex();
+
+    /**
+     * @brief Constructor.
+     *
+     * @param attributes The mutex attributes.
+     */
+    explicit FutexMutex(MutexAttributes const& attributes);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~FutexMutex();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Mutex::tryLock()
+     */
+    virtual bool_t tryLock();
+
+    /**
+     * @copydoc eoos::api::Mutex::lock()
+     */
+    virtual bool_t lock();
+
+    /**
+     * @copydoc eoos::sys::ConditionMutex::lock(int64_t)
+     */
+    virtual bool_t lock(int64_t timeout);
+
+    /**
+     * @copydoc eoos::api::Mutex::unlock()
+     */
+    virtual bool_t unlock();
+
+    /**
+     * @copydoc eoos::sys::ConditionMutex::getRequeueWord()
+     */
+    virtual int32_t* getRequeueWord();
+
+    /**
+     * @copydoc eoos::sys::ConditionMutex::lockRequeued()
+     */
+    virtual bool_t lockRequeued();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @enum State
+     * @brief State of the mutex word.
+     */
+    enum State
+    {
+        STATE_UNLOCKED = 0, ///< @brief Unlocked.
+        STATE_LOCKED   = 1, ///< @brief Locked without sleeping threads.
+        STATE_WAITED   = 2  ///< @brief Locked with possibly sleeping threads.
+    };
+
+    /**
+     * @brief Default maximum number of spin iterations before sleeping.
+     */
+    static const int32_t SPINS_MAX = 100;
+
+    /**
+     * @brief Locks the mutex contended by other threads.
+     *
+     * @param deadline Absolute CLOCK_MONOTONIC deadline in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the mutex has been locked before the deadline.
+     */
+    bool_t lockContended(int64_t deadline);
+
+    /**
+     * @brief Records a lock of the mutex to the contention profiler.
+     *
+     * @param start       Time the wait has started at.
+     * @param isContended True if the mutex has not been locked at once.
+     * @param site        The call site.
+     */
+    void onLock(int64_t start, bool_t isContended, void const* site);
+
+    /**
+     * @brief Records a failed lock of the mutex to the contention profiler.
+     *
+     * @param site The call site.
+     */
+    void onFail(void const* site) const;
+
+    /**
+     * @brief The mutex word.
+     */
+    Atomic<int32_t> word_;
+
+    /**
+     * @brief Estimation of spin iterations enough to get the mutex.
+     */
+    Atomic<int32_t> spins_;
+
+    /**
+     * @brief Maximum number of spin iterations before sleeping.
+     */
+    int32_t spinsMax_;
+
+    /**
+     * @brief Time the mutex has been locked at for the contention profiler.
+     */
+    int64_t lockedAt_;
+
+};
+
+template <class A>
+FutexMutex<A>::FutexMutex()
+    : NonCopyable<A>()
+    , ConditionMutex()
+    , word_( STATE_UNLOCKED )
+    , spins_( 0 )
+    , spinsMax_( SPINS_MAX )
+    , lockedAt_( 0 ) {
+}
+
+template <class A>
+FutexMutex<A>::FutexMutex(MutexAttributes const& attributes)
+    : NonCopyable<A>()
+    , ConditionMutex()
+    , word_( STATE_UNLOCKED )
+    , spins_( 0 )
+    , spinsMax_( (attributes.spins >= 0) ? attributes.spins : SPINS_MAX )
+    , lockedAt_( 0 ) {
+    bool_t const isConstructed( attributes.protocol == MutexAttributes::PROTOCOL_NONE );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+FutexMutex<A>::~FutexMutex()
+{
+    #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    Contention::onDestroy(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX);
+    #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+}
+
+template <class A>
+bool_t FutexMutex<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t FutexMutex<A>::tryLock()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        int32_t expected( STATE_UNLOCKED );
+        res = word_.compareExchange(expected, STATE_LOCKED, Atomic<int32_t>::ORDER_ACQUIRE);
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( res )
+        {
+            onLock(0, false, __builtin_return_address(0));
+        }
+        else
+        {
+            onFail(__builtin_return_address(0));
+        }
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexMutex<A>::lock()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        int32_t expected( STATE_UNLOCKED );
+        bool_t const isContended( !word_.compareExchange(expected, STATE_LOCKED, Atomic<int32_t>::ORDER_ACQUIRE) );
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        int64_t const start( isContended ? Clock::getTime() : 0 );
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( isContended )
+        {
+            static_cast<void>( lockContended(Clock::TIMEOUT_INFINITE) );
+        }
+        res = true;
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        onLock(start, isContended, __builtin_return_address(0));
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexMutex<A>::lock(int64_t const timeout)
+{
+    bool_t res( false );
+    if( timeout < 0 )
+    {
+        res = lock();
+    }
+    else if( isConstructed() )
+    {
+        int32_t expected( STATE_UNLOCKED );
+        res = word_.compareExchange(expected, STATE_LOCKED, Atomic<int32_t>::ORDER_ACQUIRE);
+        bool_t const isContended( !res );
+        int64_t const start( isContended ? Clock::getTime() : 0 );
+        if( isContended )
+        {
+            res = lockContended( start + timeout );
+        }
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( res )
+        {
+            onLock(start, isContended, __builtin_return_address(0));
+        }
+        else
+        {
+            onFail(__builtin_return_address(0));
+        }
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexMutex<A>::unlock()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        Contention::onRelease(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX, Clock::getTime() - lockedAt_);
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( word_.exchange(STATE_UNLOCKED, Atomic<int32_t>::ORDER_RELEASE) == STATE_WAITED )
+        {
+            static_cast<void>( Futex::wake(word_.getAddress(), 1) );
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexMutex<A>::lockContended(int64_t const deadline)
+{
+    bool_t const isBusyPoll( BusyPoll::isEnabled() );
+    // Spin up to twice of the spins were enough recently, as the glibc adaptive mutex does
+    int32_t const recent( spins_.load(Atomic<int32_t>::ORDER_RELAXED) );
+    int32_t const spins( (recent * 2 + 10 < spinsMax_) ? (recent * 2 + 10) : spinsMax_ );
+    int32_t count( 0 );
+    bool_t isLocked( false );
+    bool_t isExpired( false );
+    while( !isLocked && !isExpired && ( isBusyPoll || (count < spins) ) )
+    {
+        int32_t expected( STATE_UNLOCKED );
+        if( (word_.load(Atomic<int32_t>::ORDER_RELAXED) == STATE_UNLOCKED)
+         && (word_.compareExchange(expected, STATE_LOCKED, Atomic<int32_t>::ORDER_ACQUIRE)) )
+        {
+            isLocked = true;
+        }
+        else
+        {
+            Backoff::relax();
+            count += (count < spins) ? 1 : 0;
+            if( deadline >= 0 )
+            {
+                isExpired = Clock::getTime() >= deadline;
+            }
+        }
+    }
+    // Mark the mutex as waited, so the owner wakes a sleeping thread up on unlock
+    while( !isLocked && !isExpired )
+    {
+        if( word_.exchange(STATE_WAITED, Atomic<int32_t>::ORDER_ACQUIRE) == STATE_UNLOCKED )
+        {
+            isLocked = true;
+        }
+        else if( deadline < 0 )
+        {
+            static_cast<void>( Futex::wait(word_.getAddress(), STATE_WAITED) );
+        }
+        else
+        {
+            // The word stays marked on expiry, which costs the owner one spare wake call only
+            int64_t const timeout( deadline - Clock::getTime() );
+            isExpired = (timeout <= 0) || !Futex::wait(word_.getAddress(), STATE_WAITED, timeout);
+        }
+    }
+    if( isLocked )
+    {
+        // The estimation is updated by the mutex owner only
+        spins_.store(recent + (count - recent) / 8, Atomic<int32_t>::ORDER_RELAXED);
+    }
+    return isLocked;
+}
+
+template <class A>
+int32_t* FutexMutex<A>::getRequeueWord()
+{
+    return word_.getAddress();
+}
+
+template <class A>
+bool_t FutexMutex<A>::lockRequeued()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        // The mutex is marked as waited, as other threads may have been moved to sleep on the word
+        while( word_.exchange(STATE_WAITED, Atomic<int32_t>::ORDER_ACQUIRE) != STATE_UNLOCKED )
+        {
+            static_cast<void>( Futex::wait(word_.getAddress(), STATE_WAITED) );
+        }
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        lockedAt_ = Clock::getTime();
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+void FutexMutex<A>::onLock(int64_t const start, bool_t const isContended, void const* const site)
+{
+    lockedAt_ = Clock::getTime();
+    int64_t const wait( isContended ? (lockedAt_ - start) : 0 );
+    Contention::onAcquire(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX, wait, isContended, site);
+}
+
+template <class A>
+void FutexMutex<A>::onFail(void const* const site) const
+{
+    Contention::onFail(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX, site);
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_FUTEXMUTEX_HPP_
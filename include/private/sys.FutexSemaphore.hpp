@@ -0,0 +1,366 @@
+/**
+ * @file      sys.FutexSemaphore.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_FUTEXSEMAPHORE_HPP_
+#define SYS_FUTEXSEMAPHORE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.CountingSemaphore.hpp"
+#include "sys.Atomic.hpp"
+#include "sys.Futex.hpp"
+#include "sys.Clock.hpp"
+#include "sys.Contention.hpp"
+#include "sys.Backoff.hpp"
+#include "sys.BusyPoll.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class FutexSemaphore
+ * @brief Semaphore class on a Linux futex.
+ *
+ * The number of permits is a 32-bit word. An acquisition of an available permit and a release
+ * is one atomic instruction each. An acquisition of no available permits spins for a while, and
+ * only then sleeps in the kernel. Sleeping threads are counted, thus a release enters the kernel
+ * only if there are sleeping threads. A number of permits is acquired and released at once by one
+ * atomic instruction, and their release wakes all sleeping threads up by one call if some of them
+ * wait for more than one permit.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class FutexSemaphore : public NonCopyable<A>, public CountingSemaphore
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param permits The initial number of permits available.
+     */
+    explicit FutexSemaphore(int32_t permits);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~FutexSemaphore();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Semaphore::acquire()
+     */
+    virtual bool_t acquire();
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(int64_t)
+     */
+    virtual bool_t acquire(int64_t timeout);
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(int32_t,int64_t)
+     */
+    virtual bool_t acquire(int32_t permits, int64_t timeout);
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::tryAcquire(int32_t)
+     */
+    virtual bool_t tryAcquire(int32_t permits);
+
+    /**
+     * @copydoc eoos::api::Semaphore::release()
+     */
+    virtual bool_t release();
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::release(int32_t)
+     */
+    virtual bool_t release(int32_t permits);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Number of spin iterations before sleeping.
+     */
+    static const int32_t SPINS = 100;
+
+    /**
+     * @brief Number of threads meaning all threads.
+     */
+    static const int32_t ALL = 0x7FFFFFFF;
+
+    /**
+     * @brief Acquires a number of permits.
+     *
+     * @param permits The number of permits.
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @param site    The call site.
+     * @return True if the permits have been acquired before the timeout.
+     */
+    bool_t acquirePermits(int32_t permits, int64_t timeout, void const* site);
+
+    /**
+     * @brief Takes a number of permits if available.
+     *
+     * @param permits The number of permits.
+     * @return True if the permits have been taken.
+     */
+    bool_t take(int32_t permits);
+
+    /**
+     * @brief Acquires a number of permits which are not available.
+     *
+     * @param permits  The number of permits.
+     * @param deadline Absolute CLOCK_MONOTONIC deadline in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the permits have been acquired before the deadline.
+     */
+    bool_t acquireContended(int32_t permits, int64_t deadline);
+
+    /**
+     * @brief Wakes up sleeping threads for released permits.
+     *
+     * @param permits The number of permits.
+     */
+    void wake(int32_t permits);
+
+    /**
+     * @brief Records an acquisition of the semaphore to the contention profiler.
+     *
+     * @param start       Time the wait has started at.
+     * @param isContended True if the permit has not been acquired at once.
+     * @param site        The call site.
+     */
+    void onAcquire(int64_t start, bool_t isContended, void const* site) const;
+
+    /**
+     * @brief Number of permits available.
+     */
+    Atomic<int32_t> permits_;
+
+    /**
+     * @brief Number of sleeping threads.
+     */
+    Atomic<int32_t> waiters_;
+
+    /**
+     * @brief Number of sleeping threads waiting for more than one permit.
+     */
+    Atomic<int32_t> batches_;
+
+};
+
+template <class A>
+FutexSemaphore<A>::FutexSemaphore(int32_t const permits)
+    : NonCopyable<A>()
+    , CountingSemaphore()
+    , permits_( permits )
+    , waiters_( 0 )
+    , batches_( 0 ) {
+    bool_t const isConstructed( permits >= 0 );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+FutexSemaphore<A>::~FutexSemaphore()
+{
+    #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    Contention::onDestroy(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE);
+    #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::acquire()
+{
+    return acquirePermits(1, Clock::TIMEOUT_INFINITE, __builtin_return_address(0));
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::acquire(int64_t const timeout)
+{
+    return acquirePermits(1, timeout, __builtin_return_address(0));
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::acquire(int32_t const permits, int64_t const timeout)
+{
+    return acquirePermits(permits, timeout, __builtin_return_address(0));
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::tryAcquire(int32_t const permits)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits > 0) )
+    {
+        res = take(permits);
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( res )
+        {
+            onAcquire(0, false, __builtin_return_address(0));
+        }
+        else
+        {
+            Contention::onFail(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, __builtin_return_address(0));
+        }
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::release()
+{
+    return release(1);
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::release(int32_t const permits)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits > 0) )
+    {
+        static_cast<void>( permits_.fetchAdd(permits) );
+        if( waiters_.load() > 0 )
+        {
+            wake(permits);
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::acquirePermits(int32_t const permits, int64_t const timeout, void const* const site)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits > 0) )
+    {
+        res = take(permits);
+        bool_t const isContended( !res );
+        int64_t const start( isContended ? Clock::getTime() : 0 );
+        if( isContended )
+        {
+            res = acquireContended(permits, (timeout >= 0) ? (start + timeout) : Clock::TIMEOUT_INFINITE);
+        }
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( res )
+        {
+            onAcquire(start, isContended, site);
+        }
+        else
+        {
+            Contention::onFail(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, site);
+        }
+        #else
+        static_cast<void>( site );
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::take(int32_t const permits)
+{
+    bool_t res( false );
+    int32_t value( permits_.load(Atomic<int32_t>::ORDER_RELAXED) );
+    while( !res && (value >= permits) )
+    {
+        res = permits_.compareExchange(value, value - permits, Atomic<int32_t>::ORDER_ACQUIRE);
+    }
+    return res;
+}
+
+template <class A>
+bool_t FutexSemaphore<A>::acquireContended(int32_t const permits, int64_t const deadline)
+{
+    bool_t const isBusyPoll( BusyPoll::isEnabled() );
+    bool_t isAcquired( false );
+    bool_t isExpired( false );
+    for(int32_t count(0); !isAcquired && !isExpired && ( isBusyPoll || (count < SPINS) ); count += (count < SPINS) ? 1 : 0)
+    {
+        Backoff::relax();
+        isAcquired = take(permits);
+        if( !isAcquired && (deadline >= 0) )
+        {
+            isExpired = Clock::getTime() >= deadline;
+        }
+    }
+    if( !isAcquired && !isExpired )
+    {
+        // Count the thread before the permits are loaded, so a release after the load wakes it up
+        static_cast<void>( waiters_.fetchAdd(1) );
+        if( permits > 1 )
+        {
+            static_cast<void>( batches_.fetchAdd(1) );
+        }
+        int32_t value( permits_.load() );
+        while( !isAcquired && !isExpired )
+        {
+            if( value >= permits )
+            {
+                isAcquired = permits_.compareExchange(value, value - permits, Atomic<int32_t>::ORDER_ACQUIRE);
+            }
+            else if( deadline < 0 )
+            {
+                static_cast<void>( Futex::wait(permits_.getAddress(), value) );
+                value = permits_.load();
+            }
+            else
+            {
+                int64_t const timeout( deadline - Clock::getTime() );
+                isExpired = (timeout <= 0) || !Futex::wait(permits_.getAddress(), value, timeout);
+                value = permits_.load();
+            }
+        }
+        if( permits > 1 )
+        {
+            static_cast<void>( batches_.fetchSub(1) );
+        }
+        static_cast<void>( waiters_.fetchSub(1) );
+        if( isExpired && (permits_.load() > 0) && (waiters_.load() > 0) )
+        {
+            // A release may have woken this thread up on expiry, pass the wake on
+            wake(1);
+        }
+    }
+    return isAcquired;
+}
+
+template <class A>
+void FutexSemaphore<A>::wake(int32_t const permits)
+{
+    // A thread waiting for more permits than released shall not consume the wake of one it is enough for
+    int32_t const number( (batches_.load() > 0) ? ALL : permits );
+    static_cast<void>( Futex::wake(permits_.getAddress(), number) );
+}
+
+template <class A>
+void FutexSemaphore<A>::onAcquire(int64_t const start, bool_t const isContended, void const* const site) const
+{
+    int64_t const wait( isContended ? (Clock::getTime() - start) : 0 );
+    Contention::onAcquire(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, wait, isContended, site);
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_FUTEXSEMAPHORE_HPP_
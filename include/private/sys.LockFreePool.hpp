@@ -0,0 +1,567 @@
+/**
+ * @file      sys.LockFreePool.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_LOCKFREEPOOL_HPP_
+#define SYS_LOCKFREEPOOL_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Heap.hpp"
+#include "sys.Atomic.hpp"
+#include "sys.Spinlock.hpp"
+#include "lib.MemoryPool.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class LockFreePool
+ * @brief Lock-free memory pool of blocks for objects of one type.
+ *
+ * Free blocks are kept in a stack of block indexes, which head is tagged with a counter
+ * changed on each push and pop, thus a compare-and-swap of the head does not succeed
+ * on a head popped and pushed back meanwhile. Each thread keeps blocks it has freed
+ * in its own cache, and reuses them without touching the shared head. A thread which
+ * finds the stack empty steals blocks from caches of other threads. A cache is returned
+ * to the pool on exit of its thread, and another thread takes it with the blocks left.
+ *
+ * @tparam T Type of objects.
+ * @tparam N Number of blocks.
+ */
+template <typename T, int32_t N>
+class LockFreePool : public NonCopyable<NoAllocator>, public api::Heap
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    LockFreePool();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~LockFreePool();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Heap::allocate(size_t,void*)
+     */
+    virtual void* allocate(size_t size, void* ptr);
+
+    /**
+     * @copydoc eoos::api::Heap::free(void*)
+     */
+    virtual void free(void* ptr);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Index of no block.
+     */
+    static const int32_t NONE = -1;
+
+    /**
+     * @brief Number of thread caches.
+     */
+    static const int32_t CACHES = 16;
+
+    /**
+     * @brief Cache line size in bytes.
+     */
+    static const int32_t CACHE_LINE = 64;
+
+    /**
+     * @brief Number of blocks in a thread cache occupying a cache line.
+     */
+    static const int32_t SLOTS = CACHE_LINE / sizeof(int32_t);
+
+    /**
+     * @union Block
+     * @brief Memory block of an object.
+     */
+    union Block
+    {
+        /**
+         * @brief Object memory.
+         */
+        uint8_t memory[sizeof(T)];
+
+        /**
+         * @brief Alignment of the object.
+         */
+        int64_t alignment;
+    };
+
+    /**
+     * @struct Cache
+     * @brief Cache of a thread aligned to and occupying a whole cache line.
+     *
+     * @note Only the owner thread puts blocks to slots, and any thread takes them.
+     */
+    struct Cache
+    {
+        /**
+         * @brief Block indexes, or NONE.
+         */
+        int32_t slots[SLOTS];
+    } __attribute__((aligned(CACHE_LINE)));
+
+    /**
+     * @struct Binding
+     * @brief Cache of a thread in a pool.
+     */
+    struct Binding
+    {
+        /**
+         * @brief Identifier of the pool.
+         */
+        uint32_t pool;
+
+        /**
+         * @brief Index of the cache, or NONE.
+         */
+        int32_t cache;
+    };
+
+    /**
+     * @brief Returns the cache of the calling thread.
+     *
+     * @return The cache, or NULLPTR if the thread has no cache in the pool.
+     */
+    Cache* getCache();
+
+    /**
+     * @brief Takes a cache not used by other threads.
+     *
+     * @return The cache index, or NONE.
+     */
+    int32_t bind();
+
+    /**
+     * @brief Returns a cache of an exiting thread to the pool.
+     *
+     * @param flag The flag of the cache being used.
+     */
+    static void unbind(void* flag);
+
+    /**
+     * @brief Pops a block from the stack.
+     *
+     * @return The block index, or NONE.
+     */
+    int32_t pop();
+
+    /**
+     * @brief Pushes a block to the stack.
+     *
+     * @param index The block index.
+     */
+    void push(int32_t index);
+
+    /**
+     * @brief Takes a block from caches of threads.
+     *
+     * @return The block index, or NONE.
+     */
+    int32_t steal();
+
+    /**
+     * @brief Packs a block index and a tag to a stack head.
+     *
+     * @param index The block index.
+     * @param tag   The tag.
+     * @return The head.
+     */
+    static uint64_t pack(int32_t index, uint32_t tag);
+
+    /**
+     * @brief Identifiers of pools.
+     */
+    static Atomic<uint32_t> ids_;
+
+    /**
+     * @brief Cache of a thread.
+     */
+    static __thread Binding binding_;
+
+    /**
+     * @brief Blocks.
+     */
+    Block blocks_[N];
+
+    /**
+     * @brief Next block indexes of the stack.
+     */
+    int32_t next_[N];
+
+    /**
+     * @brief Head of the stack as a tag in high and an index in low 32 bits.
+     */
+    Atomic<uint64_t> head_;
+
+    /**
+     * @brief Caches of threads.
+     */
+    Cache caches_[CACHES];
+
+    /**
+     * @brief Flags of caches being used by threads.
+     */
+    int32_t used_[CACHES];
+
+    /**
+     * @brief Number of caches ever bound to threads.
+     */
+    Atomic<int32_t> bound_;
+
+    /**
+     * @brief Key of the cache flag returned on exit of a thread.
+     */
+    ::pthread_key_t key_;
+
+    /**
+     * @brief Identifier of the pool.
+     */
+    uint32_t id_;
+
+};
+
+/**
+ * @class LockFreePool<T,0>
+ * @brief Memory pool of objects in heap memory.
+ *
+ * @tparam T Type of objects.
+ */
+template <typename T>
+class LockFreePool<T,0> : public NonCopyable<NoAllocator>, public api::Heap
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    LockFreePool();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~LockFreePool();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Heap::allocate(size_t,void*)
+     */
+    virtual void* allocate(size_t size, void* ptr);
+
+    /**
+     * @copydoc eoos::api::Heap::free(void*)
+     */
+    virtual void free(void* ptr);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Spinlock guarding heap allocations.
+     */
+    Spinlock<NoAllocator> mutex_;
+
+    /**
+     * @brief Heap memory pool.
+     */
+    lib::MemoryPool<T,0> pool_;
+
+};
+
+template <typename T>
+LockFreePool<T,0>::LockFreePool()
+    : NonCopyable<NoAllocator>()
+    , api::Heap()
+    , mutex_()
+    , pool_( mutex_ ) {
+    bool_t const isConstructed( mutex_.isConstructed() && pool_.isConstructed() );
+    setConstructed( isConstructed );
+}
+
+template <typename T>
+LockFreePool<T,0>::~LockFreePool()
+{
+}
+
+template <typename T>
+bool_t LockFreePool<T,0>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <typename T>
+void* LockFreePool<T,0>::allocate(size_t const size, void* const ptr)
+{
+    return isConstructed() ? pool_.allocate(size, ptr) : NULLPTR;
+}
+
+template <typename T>
+void LockFreePool<T,0>::free(void* const ptr)
+{
+    if( isConstructed() )
+    {
+        pool_.free(ptr);
+    }
+}
+
+template <typename T, int32_t N>
+Atomic<uint32_t> LockFreePool<T,N>::ids_( 0U );
+
+template <typename T, int32_t N>
+__thread typename LockFreePool<T,N>::Binding LockFreePool<T,N>::binding_ = { 0U, -1 };
+
+template <typename T, int32_t N>
+LockFreePool<T,N>::LockFreePool()
+    : NonCopyable<NoAllocator>()
+    , api::Heap()
+    , blocks_()
+    , next_()
+    , head_( pack(0, 0U) )
+    , caches_()
+    , used_()
+    , bound_( 0 )
+    , key_()
+    , id_( ids_.fetchAdd(1U) + 1U ) {
+    for(int32_t i(0); i < N; i++)
+    {
+        next_[i] = (i + 1 < N) ? (i + 1) : NONE;
+    }
+    for(int32_t i(0); i < CACHES; i++)
+    {
+        for(int32_t j(0); j < SLOTS; j++)
+        {
+            caches_[i].slots[j] = NONE;
+        }
+        used_[i] = 0;
+    }
+    bool_t const isConstructed( ::pthread_key_create(&key_, unbind) == 0 );
+    setConstructed( isConstructed );
+}
+
+template <typename T, int32_t N>
+LockFreePool<T,N>::~LockFreePool()
+{
+    if( isConstructed() )
+    {
+        // Threads exiting after the pool do not touch its memory
+        static_cast<void>( ::pthread_key_delete(key_) );
+    }
+}
+
+template <typename T, int32_t N>
+bool_t LockFreePool<T,N>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <typename T, int32_t N>
+void* LockFreePool<T,N>::allocate(size_t const size, void*)
+{
+    void* addr( NULLPTR );
+    if( isConstructed() && (size <= sizeof(Block)) )
+    {
+        int32_t index( NONE );
+        Cache* const cache( getCache() );
+        if( cache != NULLPTR )
+        {
+            // Reuse the block freed last, as it is likely in the CPU cache
+            for(int32_t i(SLOTS - 1); (i >= 0) && (index == NONE); i--)
+            {
+                if( __atomic_load_n(&cache->slots[i], __ATOMIC_RELAXED) != NONE )
+                {
+                    index = __atomic_exchange_n(&cache->slots[i], NONE, __ATOMIC_ACQUIRE);
+                }
+            }
+        }
+        if( index == NONE )
+        {
+            index = pop();
+        }
+        if( index == NONE )
+        {
+            index = steal();
+        }
+        if( index != NONE )
+        {
+            addr = &blocks_[index];
+        }
+    }
+    return addr;
+}
+
+template <typename T, int32_t N>
+void LockFreePool<T,N>::free(void* const ptr)
+{
+    Block* const block( static_cast<Block*>(ptr) );
+    if( isConstructed() && (block >= &blocks_[0]) && (block < &blocks_[N]) )
+    {
+        int32_t const index( static_cast<int32_t>(block - &blocks_[0]) );
+        bool_t isCached( false );
+        Cache* const cache( getCache() );
+        if( cache != NULLPTR )
+        {
+            for(int32_t i(0); (i < SLOTS) && !isCached; i++)
+            {
+                if( __atomic_load_n(&cache->slots[i], __ATOMIC_RELAXED) == NONE )
+                {
+                    __atomic_store_n(&cache->slots[i], index, __ATOMIC_RELEASE);
+                    isCached = true;
+                }
+            }
+        }
+        if( !isCached )
+        {
+            push(index);
+        }
+    }
+}
+
+template <typename T, int32_t N>
+typename LockFreePool<T,N>::Cache* LockFreePool<T,N>::getCache()
+{
+    if( binding_.pool == 0U )
+    {
+        // Bind the thread to a cache of the first pool of the type it uses
+        binding_.pool = id_;
+        binding_.cache = NONE;
+    }
+    if( (binding_.pool == id_) && (binding_.cache == NONE) )
+    {
+        // All caches may have been used by threads exited since
+        binding_.cache = bind();
+    }
+    return ( (binding_.pool == id_) && (binding_.cache != NONE) ) ? &caches_[binding_.cache] : NULLPTR;
+}
+
+template <typename T, int32_t N>
+int32_t LockFreePool<T,N>::bind()
+{
+    int32_t cache( NONE );
+    for(int32_t i(0); (i < CACHES) && (cache == NONE); i++)
+    {
+        int32_t expected( 0 );
+        if( (__atomic_load_n(&used_[i], __ATOMIC_RELAXED) == 0)
+         && __atomic_compare_exchange_n(&used_[i], &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) )
+        {
+            cache = i;
+        }
+    }
+    if( cache != NONE )
+    {
+        if( ::pthread_setspecific(key_, &used_[cache]) != 0 )
+        {   ///< UT Justified Branch: OS dependency
+            __atomic_store_n(&used_[cache], 0, __ATOMIC_RELEASE);
+            cache = NONE;
+        }
+    }
+    if( cache != NONE )
+    {
+        // Caches stolen from are the ones ever bound
+        bool_t isCounted( false );
+        int32_t bound( bound_.load(Atomic<int32_t>::ORDER_RELAXED) );
+        while( !isCounted && (bound <= cache) )
+        {
+            isCounted = bound_.compareExchange(bound, cache + 1, Atomic<int32_t>::ORDER_RELAXED);
+        }
+    }
+    return cache;
+}
+
+template <typename T, int32_t N>
+void LockFreePool<T,N>::unbind(void* const flag)
+{
+    // The blocks left in the cache are reused by the next thread or stolen
+    __atomic_store_n(static_cast<int32_t*>(flag), 0, __ATOMIC_RELEASE);
+}
+
+template <typename T, int32_t N>
+int32_t LockFreePool<T,N>::pop()
+{
+    int32_t index( NONE );
+    uint64_t head( head_.load(Atomic<uint64_t>::ORDER_ACQUIRE) );
+    while( true )
+    {
+        index = static_cast<int32_t>( static_cast<uint32_t>(head) );
+        if( index == NONE )
+        {
+            break;
+        }
+        // The next index may be stale if the block is popped meanwhile, but then the tag differs
+        int32_t const next( __atomic_load_n(&next_[index], __ATOMIC_RELAXED) );
+        uint32_t const tag( static_cast<uint32_t>(head >> 32) + 1U );
+        if( head_.compareExchange(head, pack(next, tag), Atomic<uint64_t>::ORDER_ACQ_REL) )
+        {
+            break;
+        }
+    }
+    return index;
+}
+
+template <typename T, int32_t N>
+void LockFreePool<T,N>::push(int32_t const index)
+{
+    uint64_t head( head_.load(Atomic<uint64_t>::ORDER_RELAXED) );
+    while( true )
+    {
+        __atomic_store_n(&next_[index], static_cast<int32_t>( static_cast<uint32_t>(head) ), __ATOMIC_RELAXED);
+        uint32_t const tag( static_cast<uint32_t>(head >> 32) + 1U );
+        if( head_.compareExchange(head, pack(index, tag), Atomic<uint64_t>::ORDER_ACQ_REL) )
+        {
+            break;
+        }
+    }
+}
+
+template <typename T, int32_t N>
+int32_t LockFreePool<T,N>::steal()
+{
+    int32_t index( NONE );
+    int32_t const caches( bound_.load() );
+    for(int32_t i(0); (i < caches * SLOTS) && (index == NONE); i++)
+    {
+        int32_t* const slot( &caches_[i / SLOTS].slots[i % SLOTS] );
+        if( __atomic_load_n(slot, __ATOMIC_RELAXED) != NONE )
+        {
+            index = __atomic_exchange_n(slot, NONE, __ATOMIC_ACQUIRE);
+        }
+    }
+    return index;
+}
+
+template <typename T, int32_t N>
+uint64_t LockFreePool<T,N>::pack(int32_t const index, uint32_t const tag)
+{
+    return (static_cast<uint64_t>(tag) << 32) | static_cast<uint64_t>( static_cast<uint32_t>(index) );
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_LOCKFREEPOOL_HPP_
@@ -1,13 +1,18 @@
 /**
  * @file      sys.Mutex.hpp
  * @author    Sergey Baigudin, sergey@baigudin.software
- * @copyright 2021-2023, Sergey Baigudin, Baigudin Software
+ * @copyright 2021-2026, Sergey Baigudin, Baigudin Software
  */
 #ifndef SYS_MUTEX_HPP_
 #define SYS_MUTEX_HPP_
 
 #include "sys.NonCopyable.hpp"
-#include "api.Mutex.hpp"
+#include "sys.ConditionMutex.hpp"
+#include "sys.MutexAttributes.hpp"
+#include "sys.BusyPoll.hpp"
+#include "sys.Backoff.hpp"
+#include "sys.Clock.hpp"
+#include "sys.Contention.hpp"
 
 namespace eoos
 {
@@ -21,7 +26,7 @@ namespace sys
  * @tparam A Heap memory allocator class.
  */
 template <class A>
-class Mutex : public NonCopyable<A>, public api::Mutex
+class Mutex : public NonCopyable<A>, public ConditionMutex
 {
     typedef NonCopyable<A> Parent;
 
@@ -32,6 +37,30 @@ public:
      */
     Mutex();
 
+    /**
+     * @brief Constructor.
+     *
+     * @param attributes The mutex attributes.
+     */
+    explicit Mutex(MutexAttributes const& attributes);
+
+    /**
+     * @brief Constructor of a robust mutex shared between processes.
+     *
+     * The mutex is initialized in shared memory, and the destructor destroys it.
+     *
+     * @param attributes The mutex attributes.
+     * @param shared     The mutex memory in memory shared between processes.
+     */
+    Mutex(MutexAttributes const& attributes, ::pthread_mutex_t* shared);
+
+    /**
+     * @brief Constructor of a mutex shared between processes initialized by another process.
+     *
+     * @param shared The mutex memory in memory shared between processes.
+     */
+    explicit Mutex(::pthread_mutex_t* shared);
+
     /**
      * @brief Destructor.
      */
@@ -52,11 +81,35 @@ public:
      */
     virtual bool_t lock();
 
+    /**
+     * @copydoc eoos::sys::ConditionMutex::lock(int64_t)
+     */
+    virtual bool_t lock(int64_t timeout);
+
     /**
      * @copydoc eoos::api::Mutex::unlock()
      */
     virtual bool_t unlock();
 
+    /**
+     * @copydoc eoos::sys::ConditionMutex::getRequeueWord()
+     */
+    virtual int32_t* getRequeueWord();
+
+    /**
+     * @copydoc eoos::sys::ConditionMutex::lockRequeued()
+     */
+    virtual bool_t lockRequeued();
+
+    /**
+     * @brief Tests if the last lock has recovered the mutex from an owner terminated while holding it.
+     *
+     * @note Data guarded by a recovered mutex may be inconsistent and shall be checked by the new owner.
+     *
+     * @return True if the mutex has been recovered.
+     */
+    bool_t isRecovered() const;
+
 protected:
 
     using Parent::setConstructed;
@@ -66,41 +119,168 @@ private:
     /**
      * @brief Constructs this object.
      *
+     * @param attributes The mutex attributes.
      * @return True if object has been constructed successfully.
      */
-    bool_t construct();
+    bool_t construct(MutexAttributes const& attributes);
 
     /**
      * @brief Initializes kernel mutex resource.
      * 
+     * @param attributes The mutex attributes.
      * @return True if initialized sucessfully. 
      */
-    bool_t initialize();
+    bool_t initialize(MutexAttributes const& attributes);
+
+    /**
+     * @brief Recovers the mutex locked after its owner has terminated.
+     *
+     * @param error Error number of locking the mutex.
+     * @return Error number or zero if the mutex is locked.
+     */
+    int_t recover(int_t error);
+
+    /**
+     * @brief Returns the POSIX mutex type.
+     *
+     * @param type The mutex type.
+     * @return The POSIX mutex type.
+     */
+    static int_t getType(MutexAttributes::Type type);
+
+    /**
+     * @brief Sets the priority protocol to POSIX mutex attributes.
+     *
+     * @param attr       The POSIX mutex attributes.
+     * @param attributes The mutex attributes.
+     * @return Error number or zero.
+     */
+    static int_t setProtocol(::pthread_mutexattr_t& attr, MutexAttributes const& attributes);
+
+    /**
+     * @brief Locks the POSIX mutex until a CLOCK_MONOTONIC deadline.
+     *
+     * @param timeout Relative timeout in nanoseconds.
+     * @return Error number or zero.
+     */
+    int_t lockTimed(int64_t timeout);
 
     /**
      * @brief Deinitializes kernel mutex resource.
      */
     void deinitialize();
 
+    /**
+     * @brief Records a lock of the mutex to the contention profiler.
+     *
+     * @param start       Time the wait has started at.
+     * @param isContended True if the mutex has not been locked at once.
+     * @param site        The call site.
+     */
+    void onLock(int64_t start, bool_t isContended, void const* site);
+
+    /**
+     * @brief Records a failed lock of the mutex to the contention profiler.
+     *
+     * @param site The call site.
+     */
+    void onFail(void const* site) const;
+
     /**
      * @brief Mutex POSIX resource identifier.
      */
     ::pthread_mutex_t mutex_;
+
+    /**
+     * @brief The POSIX mutex used, which is this mutex resource or a mutex in shared memory.
+     */
+    ::pthread_mutex_t* handle_;
+
+    /**
+     * @brief The POSIX mutex is initialized by this object.
+     */
+    bool_t isOwner_;
+
+    /**
+     * @brief The last lock has recovered the mutex.
+     */
+    bool_t isRecovered_;
+
+    /**
+     * @brief Number of tries to lock the mutex before sleeping.
+     */
+    int32_t spins_;
+
+    /**
+     * @brief Time the mutex has been locked at for the contention profiler.
+     */
+    int64_t lockedAt_;
     
 };
 
 template <class A>
 Mutex<A>::Mutex()
     : NonCopyable<A>()
-    , api::Mutex()
-    , mutex_() {
-    bool_t const isConstructed( construct() );
+    , ConditionMutex()
+    , mutex_()
+    , handle_( &mutex_ )
+    , isOwner_( true )
+    , isRecovered_( false )
+    , spins_( 0 )
+    , lockedAt_( 0 ) {
+    MutexAttributes const attributes;
+    bool_t const isConstructed( construct(attributes) );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+Mutex<A>::Mutex(MutexAttributes const& attributes)
+    : NonCopyable<A>()
+    , ConditionMutex()
+    , mutex_()
+    , handle_( &mutex_ )
+    , isOwner_( true )
+    , isRecovered_( false )
+    , spins_( 0 )
+    , lockedAt_( 0 ) {
+    bool_t const isConstructed( construct(attributes) );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+Mutex<A>::Mutex(MutexAttributes const& attributes, ::pthread_mutex_t* const shared)
+    : NonCopyable<A>()
+    , ConditionMutex()
+    , mutex_()
+    , handle_( shared )
+    , isOwner_( true )
+    , isRecovered_( false )
+    , spins_( 0 )
+    , lockedAt_( 0 ) {
+    bool_t const isConstructed( construct(attributes) );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+Mutex<A>::Mutex(::pthread_mutex_t* const shared)
+    : NonCopyable<A>()
+    , ConditionMutex()
+    , mutex_()
+    , handle_( shared )
+    , isOwner_( false )
+    , isRecovered_( false )
+    , spins_( 0 )
+    , lockedAt_( 0 ) {
+    bool_t const isConstructed( handle_ != NULLPTR );
     setConstructed( isConstructed );
 }
 
 template <class A>
 Mutex<A>::~Mutex()
 {
+    #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    Contention::onDestroy(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX);
+    #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
     deinitialize();
 }
 
@@ -116,8 +296,18 @@ bool_t Mutex<A>::tryLock()
     bool_t res( false );
     if( isConstructed() )
     {
-        int_t const error( ::pthread_mutex_trylock(&mutex_) );
+        int_t const error( recover( ::pthread_mutex_trylock(handle_) ) );
         res = (error == 0) ? true : false;
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( res )
+        {
+            onLock(0, false, __builtin_return_address(0));
+        }
+        else
+        {
+            onFail(__builtin_return_address(0));
+        }
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
     }
     return res;
 }    
@@ -128,11 +318,102 @@ bool_t Mutex<A>::lock()
     bool_t res( false );
     if( isConstructed() )
     {
-        int_t const error( ::pthread_mutex_lock(&mutex_) );
+        int_t error( EBUSY );
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        error = ::pthread_mutex_trylock(handle_);
+        bool_t const isContended( error == EBUSY );
+        int64_t const start( isContended ? Clock::getTime() : 0 );
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( error == EBUSY )
+        {
+            if( BusyPoll::isEnabled() )
+            {
+                Backoff backoff;
+                error = ::pthread_mutex_trylock(handle_);
+                while( error == EBUSY )
+                {
+                    backoff.pause();
+                    error = ::pthread_mutex_trylock(handle_);
+                }
+            }
+            else
+            {
+                if( spins_ > 0 )
+                {
+                    Backoff backoff;
+                    for(int32_t i(0); (i < spins_) && (error == EBUSY); i++)
+                    {
+                        error = ::pthread_mutex_trylock(handle_);
+                        if( error == EBUSY )
+                        {
+                            backoff.pause();
+                        }
+                    }
+                }
+                if( error == EBUSY )
+                {
+                    error = ::pthread_mutex_lock(handle_);
+                }
+            }
+        }
+        error = recover(error);
         if( error == 0 ) 
         {
             res = true;
+            #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+            onLock(start, isContended, __builtin_return_address(0));
+            #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t Mutex<A>::lock(int64_t const timeout)
+{
+    bool_t res( false );
+    if( timeout < 0 )
+    {
+        res = lock();
+    }
+    else if( isConstructed() )
+    {
+        int_t error( ::pthread_mutex_trylock(handle_) );
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        bool_t const isContended( error == EBUSY );
+        int64_t const start( isContended ? Clock::getTime() : 0 );
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( error == EBUSY )
+        {
+            if( BusyPoll::isEnabled() )
+            {
+                Backoff backoff;
+                int64_t const deadline( Clock::getTime() + timeout );
+                while( (error == EBUSY) && (Clock::getTime() < deadline) )
+                {
+                    backoff.pause();
+                    error = ::pthread_mutex_trylock(handle_);
+                }
+            }
+            else
+            {
+                error = lockTimed(timeout);
+            }
+        }
+        error = recover(error);
+        if( error == 0 )
+        {
+            res = true;
+            #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+            onLock(start, isContended, __builtin_return_address(0));
+            #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
         }
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        else
+        {
+            onFail(__builtin_return_address(0));
+        }
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
     }
     return res;
 }
@@ -143,23 +424,48 @@ bool_t Mutex<A>::unlock()
     bool_t res( false );
     if( isConstructed() )
     {
-        int_t const error( ::pthread_mutex_unlock(&mutex_) );
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        int64_t const hold( Clock::getTime() - lockedAt_ );
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        int_t const error( ::pthread_mutex_unlock(handle_) );
         if( error == 0 )
         {
             res = true;
+            #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+            Contention::onRelease(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX, hold);
+            #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
         }
     }
     return res;
 }
 
 template <class A>
-bool_t Mutex<A>::construct()
+int32_t* Mutex<A>::getRequeueWord()
+{
+    return NULLPTR;
+}
+
+template <class A>
+bool_t Mutex<A>::lockRequeued()
+{
+    return lock();
+}
+
+template <class A>
+bool_t Mutex<A>::isRecovered() const
+{
+    return isRecovered_;
+}
+
+template <class A>
+bool_t Mutex<A>::construct(MutexAttributes const& attributes)
 {
     bool_t res( false );
     if( isConstructed() )
     {
-        if( initialize() )
+        if( initialize(attributes) )
         {
+            spins_ = (attributes.spins > 0) ? attributes.spins : 0;
             res = true;
         }        
     }
@@ -167,16 +473,156 @@ bool_t Mutex<A>::construct()
 }
 
 template <class A>
-bool_t Mutex<A>::initialize()
+bool_t Mutex<A>::initialize(MutexAttributes const& attributes)
 {
-    int_t const error( ::pthread_mutex_init(&mutex_, NULL) );
+    ::pthread_mutexattr_t attr;
+    int_t error( (handle_ != NULLPTR) ? ::pthread_mutexattr_init(&attr) : EINVAL );
+    if( error == 0 )
+    {
+        error = ::pthread_mutexattr_settype(&attr, getType(attributes.type));
+        if( error == 0 )
+        {
+            error = setProtocol(attr, attributes);
+        }
+        if( (error == 0) && (handle_ != &mutex_) )
+        {
+            // A peer process may terminate while holding the mutex shared with it
+            error = ::pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+            if( error == 0 )
+            {
+                error = ::pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+            }
+        }
+        if( error == 0 )
+        {
+            error = ::pthread_mutex_init(handle_, &attr);
+        }
+        static_cast<void>( ::pthread_mutexattr_destroy(&attr) );
+    }
     return error == 0;
 }
 
+template <class A>
+int_t Mutex<A>::recover(int_t const error)
+{
+    // The flag is written by the owner only, as a failed lock races with it
+    int_t res( error );
+    if( error == 0 )
+    {
+        isRecovered_ = false;
+    }
+    else if( error == EOWNERDEAD )
+    {
+        // The mutex is locked, but stays unusable after unlock unless it is marked consistent
+        res = ::pthread_mutex_consistent(handle_);
+        if( res == 0 )
+        {
+            isRecovered_ = true;
+        }
+        else
+        {   ///< UT Justified Branch: OS dependency
+            // The lock is reported as failed, thus the mutex is not left locked, and becomes not recoverable
+            static_cast<void>( ::pthread_mutex_unlock(handle_) );
+        }
+    }
+    return res;
+}
+
+template <class A>
+int_t Mutex<A>::getType(MutexAttributes::Type const type)
+{
+    int_t res( PTHREAD_MUTEX_DEFAULT );
+    if( type == MutexAttributes::TYPE_ERRORCHECK )
+    {
+        res = PTHREAD_MUTEX_ERRORCHECK;
+    }
+    else if( type == MutexAttributes::TYPE_ADAPTIVE )
+    {
+        #ifdef __GLIBC__
+        res = PTHREAD_MUTEX_ADAPTIVE_NP;
+        #endif // __GLIBC__
+    }
+    else
+    {
+        #ifdef EOOS_GLOBAL_SYS_MUTEX_ERRORCHECK
+        res = PTHREAD_MUTEX_ERRORCHECK;
+        #endif // EOOS_GLOBAL_SYS_MUTEX_ERRORCHECK
+    }
+    return res;
+}
+
+template <class A>
+int_t Mutex<A>::setProtocol(::pthread_mutexattr_t& attr, MutexAttributes const& attributes)
+{
+    int_t error( 0 );
+    if( attributes.protocol == MutexAttributes::PROTOCOL_INHERIT )
+    {
+        error = ::pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+    }
+    else if( attributes.protocol == MutexAttributes::PROTOCOL_PROTECT )
+    {
+        error = EINVAL;
+        // Map the ceiling in range of api::Thread priorities to the range of the real-time policy
+        int_t const min( ::sched_get_priority_min(SCHED_RR) );
+        int_t const max( ::sched_get_priority_max(SCHED_RR) );
+        int32_t const ceiling( attributes.ceiling );
+        if( (min != -1) && (max != -1) && (api::Thread::PRIORITY_MIN <= ceiling) && (ceiling <= api::Thread::PRIORITY_MAX) )
+        {
+            int_t const priority( min + ( (ceiling - api::Thread::PRIORITY_MIN) * (max - min) ) / (api::Thread::PRIORITY_MAX - api::Thread::PRIORITY_MIN) );
+            error = ::pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_PROTECT);
+            if( error == 0 )
+            {
+                error = ::pthread_mutexattr_setprioceiling(&attr, priority);
+            }
+        }
+    }
+    else
+    {
+        error = ::pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_NONE);
+    }
+    return error;
+}
+
+template <class A>
+int_t Mutex<A>::lockTimed(int64_t const timeout)
+{
+    #if defined (__GLIBC__) && ( (__GLIBC__ > 2) || (__GLIBC_MINOR__ >= 30) )
+    ::timespec const deadline( Clock::getDeadline(timeout) );
+    int_t error( ::pthread_mutex_clocklock(handle_, CLOCK_MONOTONIC, &deadline) );
+    if( error == EINVAL )
+    {   ///< UT Justified Branch: OS dependency
+        // Kernels before Linux 5.14 do not support CLOCK_MONOTONIC for priority inheritance mutexes
+        ::timespec const realtime( Clock::getDeadline(timeout, CLOCK_REALTIME) );
+        error = ::pthread_mutex_timedlock(handle_, &realtime);
+    }
+    #else
+    ::timespec const realtime( Clock::getDeadline(timeout, CLOCK_REALTIME) );
+    int_t const error( ::pthread_mutex_timedlock(handle_, &realtime) );
+    #endif
+    return error;
+}
+
 template <class A>
 void Mutex<A>::deinitialize()
 {
-    static_cast<void>( ::pthread_mutex_destroy(&mutex_) );
+    if( isOwner_ && (handle_ != NULLPTR) )
+    {
+        static_cast<void>( ::pthread_mutex_destroy(handle_) );
+    }
+}
+
+template <class A>
+void Mutex<A>::onLock(int64_t const start, bool_t const isContended, void const* const site)
+{
+    lockedAt_ = Clock::getTime();
+    int64_t const wait( isContended ? (lockedAt_ - start) : 0 );
+    Contention::onAcquire(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX, wait, isContended, site);
+}
+
+template <class A>
+void Mutex<A>::onFail(void const* const site) const
+{
+    Contention::onFail(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX, site);
 }
 
 } // namespace sys
@@ -0,0 +1,112 @@
+/**
+ * @file      sys.MutexAttributes.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_MUTEXATTRIBUTES_HPP_
+#define SYS_MUTEXATTRIBUTES_HPP_
+
+#include "sys.Types.hpp"
+#include "api.Thread.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @struct MutexAttributes
+ * @brief Attributes of a mutex.
+ */
+struct MutexAttributes
+{
+
+    /**
+     * @enum Kind
+     * @brief Mutex implementation created by the mutex manager.
+     *
+     * @note A lock of a KIND_QUEUE mutex fails if the calling thread already holds QueueMutex::NODES
+     *       queue mutexes, as each held mutex takes one of a fixed number of thread-local queue nodes.
+     *       A KIND_QUEUE mutex shall be unlocked by the thread that has locked it, otherwise the node
+     *       accounting of both threads is corrupted.
+     */
+    enum Kind
+    {
+        KIND_DEFAULT, ///< @brief POSIX mutex, or futex one if EOOS_GLOBAL_SYS_MUTEX_FUTEX is defined.
+        KIND_POSIX,   ///< @brief POSIX mutex.
+        KIND_FUTEX,   ///< @brief Futex mutex with adaptive spinning.
+        KIND_QUEUE    ///< @brief MCS queue mutex with FIFO handoff for heavily contended paths.
+    };
+
+    /**
+     * @enum Type
+     * @brief Mutex type.
+     */
+    enum Type
+    {
+        TYPE_DEFAULT,   ///< @brief Default mutex, or error-checking one if EOOS_GLOBAL_SYS_MUTEX_ERRORCHECK is defined.
+        TYPE_ADAPTIVE,  ///< @brief Mutex spinning in the kernel while the owner is running before sleeping.
+        TYPE_ERRORCHECK ///< @brief Mutex returning errors on relocking and unlocking not by the owner.
+    };
+
+    /**
+     * @enum Protocol
+     * @brief Mutex priority protocol.
+     *
+     * @note The protocols are intended for builds with EOOS_GLOBAL_SYS_SCHEDULER_REALTIME defined.
+     */
+    enum Protocol
+    {
+        PROTOCOL_NONE,    ///< @brief The owner priority is not changed.
+        PROTOCOL_INHERIT, ///< @brief The owner inherits the highest priority of threads waiting for the mutex.
+        PROTOCOL_PROTECT  ///< @brief The owner runs at the mutex priority ceiling.
+    };
+
+    /**
+     * @brief Number of spins chosen by the mutex implementation.
+     */
+    static const int32_t SPINS_DEFAULT = -1;
+
+    /**
+     * @brief Constructor of default attributes.
+     */
+    MutexAttributes();
+
+    /**
+     * @brief The mutex implementation.
+     */
+    Kind kind;
+
+    /**
+     * @brief The mutex type.
+     */
+    Type type;
+
+    /**
+     * @brief Maximum number of tries to lock the mutex in user space before sleeping, or SPINS_DEFAULT.
+     */
+    int32_t spins;
+
+    /**
+     * @brief The mutex priority protocol.
+     */
+    Protocol protocol;
+
+    /**
+     * @brief Priority ceiling of the PROTOCOL_PROTECT protocol in range of api::Thread priorities.
+     */
+    int32_t ceiling;
+
+};
+
+inline MutexAttributes::MutexAttributes()
+    : kind( KIND_DEFAULT )
+    , type( TYPE_DEFAULT )
+    , spins( SPINS_DEFAULT )
+    , protocol( PROTOCOL_NONE )
+    , ceiling( api::Thread::PRIORITY_MAX ) {
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_MUTEXATTRIBUTES_HPP_
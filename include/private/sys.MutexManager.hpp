@@ -9,7 +9,10 @@
 #include "sys.NonCopyable.hpp"
 #include "api.MutexManager.hpp"
 #include "sys.Mutex.hpp"
-#include "lib.MemoryPool.hpp"
+#include "sys.FutexMutex.hpp"
+#include "sys.QueueMutex.hpp"
+#include "sys.Contention.hpp"
+#include "sys.LockFreePool.hpp"
 
 namespace eoos
 {
@@ -23,10 +26,56 @@ namespace sys
 class MutexManager : public NonCopyable<NoAllocator>, public api::MutexManager
 {
     typedef NonCopyable<NoAllocator> Parent;
-    typedef Mutex<MutexManager> Resource;
+
+    /**
+     * @union Resource
+     * @brief Memory of a mutex resource of any kind.
+     */
+    union Resource
+    {
+        /**
+         * @brief POSIX mutex memory.
+         */
+        uint8_t posix[sizeof(Mutex<MutexManager>)];
+
+        /**
+         * @brief Futex mutex memory.
+         */
+        uint8_t futex[sizeof(FutexMutex<MutexManager>)];
+
+        /**
+         * @brief Queue mutex memory.
+         */
+        uint8_t queue[sizeof(QueueMutex<MutexManager>)];
+
+        /**
+         * @brief Alignment of the mutexes.
+         */
+        int64_t alignment;
+    };
 
 public:
 
+    /**
+     * @brief Size of storage for a mutex resource of any kind.
+     */
+    static const size_t STORAGE_SIZE = sizeof(Resource);
+
+    /**
+     * @brief Alignment of storage for a mutex resource of any kind.
+     */
+    static const size_t STORAGE_ALIGNMENT = __alignof__(Resource);
+
+    /**
+     * @brief Size of shared memory for a mutex shared between processes.
+     */
+    static const size_t SHARED_SIZE = sizeof(::pthread_mutex_t);
+
+    /**
+     * @brief Alignment of shared memory for a mutex shared between processes.
+     */
+    static const size_t SHARED_ALIGNMENT = __alignof__(::pthread_mutex_t);
+
     /**
      * @brief Constructor.
      */
@@ -45,7 +94,85 @@ public:
     /**
      * @copydoc eoos::api::MutexManager::create()
      */
-    virtual api::Mutex* create();
+    virtual ConditionMutex* create();
+
+    /**
+     * @brief Creates a new mutex resource with attributes.
+     *
+     * @param attributes The mutex attributes.
+     * @return A new mutex resource, or NULLPTR if an error has been occurred.
+     */
+    ConditionMutex* create(MutexAttributes const& attributes);
+
+    /**
+     * @brief Creates a new mutex resource in caller storage.
+     *
+     * @param storage Storage of STORAGE_SIZE bytes aligned to STORAGE_ALIGNMENT.
+     * @return A new mutex resource, or NULLPTR if an error has been occurred.
+     */
+    ConditionMutex* create(void* storage);
+
+    /**
+     * @brief Creates a new mutex resource with attributes in caller storage.
+     *
+     * @note The resource shall be destroyed by the destroy() function, and not deleted.
+     *
+     * @param storage    Storage of STORAGE_SIZE bytes aligned to STORAGE_ALIGNMENT.
+     * @param attributes The mutex attributes.
+     * @return A new mutex resource, or NULLPTR if an error has been occurred.
+     */
+    ConditionMutex* create(void* storage, MutexAttributes const& attributes);
+
+    /**
+     * @brief Destroys a mutex resource created in caller storage.
+     *
+     * @param mutex The mutex resource, or NULLPTR.
+     */
+    void destroy(api::Mutex* mutex);
+
+    /**
+     * @brief Creates a new robust mutex in memory shared between processes.
+     *
+     * The mutex is a POSIX one, and other processes open it by the openShared() function.
+     * If a process terminates while holding the mutex, the next lock recovers the mutex.
+     *
+     * @note The resource returned is local to the process and shall be deleted after the mutex is not used
+     *       by other processes, as the deletion destroys the mutex in the shared memory.
+     *
+     * @param memory Shared memory of SHARED_SIZE bytes aligned to SHARED_ALIGNMENT.
+     * @return A new mutex resource, or NULLPTR if an error has been occurred.
+     */
+    Mutex<MutexManager>* createShared(void* memory);
+
+    /**
+     * @brief Creates a new robust mutex with attributes in memory shared between processes.
+     *
+     * @param memory     Shared memory of SHARED_SIZE bytes aligned to SHARED_ALIGNMENT.
+     * @param attributes The mutex attributes of the KIND_DEFAULT or KIND_POSIX kind.
+     * @return A new mutex resource, or NULLPTR if an error has been occurred or the kind is another one.
+     */
+    Mutex<MutexManager>* createShared(void* memory, MutexAttributes const& attributes);
+
+    /**
+     * @brief Opens a mutex created in memory shared between processes by another process.
+     *
+     * @note The resource returned is local to the process, and its deletion does not destroy the mutex.
+     *
+     * @param memory Shared memory of the mutex mapped to the process.
+     * @return A new mutex resource, or NULLPTR if an error has been occurred.
+     */
+    Mutex<MutexManager>* openShared(void* memory);
+
+    /**
+     * @brief Returns contention reports of the most waited mutexes.
+     *
+     * @note The mutexes record contention if EOOS_GLOBAL_SYS_CONTENTION_PROFILE is defined.
+     *
+     * @param reports Array for the reports ordered by total wait time descending.
+     * @param number  Size of the array.
+     * @return Number of the reports.
+     */
+    int32_t getReports(Contention::Report* reports, int32_t number) const;
 
     /**
      * @brief Allocates memory.
@@ -88,6 +215,26 @@ private:
      */
     static void deinitialize();
 
+    /**
+     * @brief Creates a new mutex resource of a kind.
+     *
+     * @param attributes The mutex attributes.
+     * @param storage    Caller storage, or NULLPTR to allocate the resource.
+     * @return A new mutex resource, or NULLPTR if an error has been occurred.
+     */
+    static ConditionMutex* createResource(MutexAttributes const& attributes, void* storage);
+
+    /**
+     * @brief Creates a new mutex resource of a class.
+     *
+     * @tparam R The mutex class.
+     * @param attributes The mutex attributes.
+     * @param storage    Caller storage, or NULLPTR to allocate the resource.
+     * @return A new mutex resource, or NULLPTR if an error has been occurred.
+     */
+    template <class R>
+    static ConditionMutex* newResource(MutexAttributes const& attributes, void* storage);
+
     /**
      * @struct ResourcePool
      * @brief Resource memory pool.
@@ -102,19 +249,10 @@ private:
          */
         ResourcePool();
 
-    private:
-
-        /**
-         * @brief Mutex resource.
-         */
-        Mutex<NoAllocator> mutex_;
-
-    public:
-
         /**
          * @brief Mutex memory allocator.
          */
-        lib::MemoryPool<Resource,EOOS_GLOBAL_SYS_MUTEX_AMOUNT> memory;
+        LockFreePool<Resource,EOOS_GLOBAL_SYS_MUTEX_AMOUNT> memory;
 
     };
 
@@ -0,0 +1,567 @@
+/**
+ * @file      sys.Parallel.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_PARALLEL_HPP_
+#define SYS_PARALLEL_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Atomic.hpp"
+#include "api.Scheduler.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Parallel
+ * @brief Parallel loop algorithms executed on threads of a scheduler.
+ *
+ * A range is split into chunks which are claimed dynamically by the calling thread and worker
+ * threads created through the scheduler. Each claim takes a half of the remaining range share
+ * of one thread but not less than the grain, thus chunks shrink while the range drains and
+ * threads on fast cores simply claim more of them. A range not exceeding the grain is executed
+ * serially by the calling thread without creating any thread.
+ *
+ * @note If a worker thread cannot be created, the range is executed by the threads created.
+ */
+class Parallel
+{
+
+public:
+
+    /**
+     * @struct Range
+     * @brief Half-open range of indices [begin, end).
+     */
+    struct Range
+    {
+        /**
+         * @brief Constructor.
+         *
+         * @param aBegin The first index.
+         * @param aEnd   The index next to the last one.
+         */
+        Range(int32_t aBegin, int32_t aEnd);
+
+        /**
+         * @brief The first index.
+         */
+        int32_t begin;
+
+        /**
+         * @brief The index next to the last one.
+         */
+        int32_t end;
+    };
+
+    /**
+     * @brief Executes a body over a range in parallel.
+     *
+     * @param scheduler The scheduler to create worker threads.
+     * @param range     The range to execute.
+     * @param grain     The minimal number of indices executed by one call of the body.
+     * @param body      The body with the void operator()(Range const&) executing a sub-range.
+     * @return True if the whole range has been executed.
+     *
+     * @tparam B Body type.
+     */
+    template <class B>
+    static bool_t parallelFor(api::Scheduler& scheduler, Range const& range, int32_t grain, B& body);
+
+    /**
+     * @brief Reduces a range in parallel.
+     *
+     * @param scheduler The scheduler to create worker threads.
+     * @param range     The range to reduce.
+     * @param grain     The minimal number of indices reduced by one call of the body.
+     * @param identity  The identity value of the reduction.
+     * @param body      The body with the T operator()(Range const&, T) accumulating a sub-range to a value,
+     *                  and with the T join(T, T) joining two values.
+     * @param result    The reduced value.
+     * @return True if the whole range has been reduced.
+     *
+     * @note The join shall be associative and commutative, and the identity value shall be neutral to it,
+     *       as each thread accumulates the sub-ranges it claims in any order, and the values of threads
+     *       are joined in the order of thread indices, not of the sub-ranges.
+     *
+     * @tparam T Value type.
+     * @tparam B Body type.
+     */
+    template <typename T, class B>
+    static bool_t parallelReduce(api::Scheduler& scheduler, Range const& range, int32_t grain, T identity, B& body, T& result);
+
+private:
+
+    /**
+     * @brief Maximum number of threads executing one range.
+     */
+    static const int32_t THREADS_MAX = EOOS_GLOBAL_SYS_PARALLEL_THREADS;
+
+    /**
+     * @class Loop
+     * @brief Loop over a range executed by a number of threads.
+     *
+     * @tparam K Kernel type with the void work(Loop&, int32_t) function executed by each thread.
+     */
+    template <class K>
+    class Loop : public NonCopyable<NoAllocator>
+    {
+        typedef NonCopyable<NoAllocator> Parent;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param range  The range to execute.
+         * @param grain  The minimal chunk size.
+         * @param kernel The kernel to execute.
+         */
+        Loop(Range const& range, int32_t grain, K& kernel);
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Loop();
+
+        /**
+         * @brief Executes the range by the calling thread and worker threads.
+         *
+         * @param scheduler The scheduler to create worker threads.
+         * @return Number of threads executed the range.
+         */
+        int32_t execute(api::Scheduler& scheduler);
+
+        /**
+         * @brief Claims next chunk of the range.
+         *
+         * @param chunk The claimed chunk.
+         * @return True if a chunk has been claimed, or false if the range is drained.
+         */
+        bool_t claim(Range& chunk);
+
+    private:
+
+        /**
+         * @class Worker
+         * @brief Task of a worker thread.
+         */
+        class Worker : public NonCopyable<NoAllocator>, public api::Task
+        {
+            typedef NonCopyable<NoAllocator> Parent;
+
+        public:
+
+            /**
+             * @brief Constructor.
+             */
+            Worker();
+
+            /**
+             * @brief Destructor.
+             */
+            virtual ~Worker();
+
+            /**
+             * @copydoc eoos::api::Object::isConstructed()
+             */
+            virtual bool_t isConstructed() const;
+
+            /**
+             * @copydoc eoos::api::Task::start()
+             */
+            virtual void start();
+
+            /**
+             * @copydoc eoos::api::Task::getStackSize()
+             */
+            virtual size_t getStackSize() const;
+
+            /**
+             * @brief Binds the worker to a loop.
+             *
+             * @param loop  The loop to execute.
+             * @param index The worker index.
+             */
+            void bind(Loop* loop, int32_t index);
+
+        private:
+
+            /**
+             * @brief The loop to execute.
+             */
+            Loop* loop_;
+
+            /**
+             * @brief The worker index.
+             */
+            int32_t index_;
+
+        };
+
+        /**
+         * @brief Returns number of threads to execute the range.
+         *
+         * @return Number of threads including the calling thread.
+         */
+        int32_t getThreadsNumber() const;
+
+        /**
+         * @brief The range end.
+         */
+        int32_t end_;
+
+        /**
+         * @brief The minimal chunk size.
+         */
+        int32_t grain_;
+
+        /**
+         * @brief Number of threads executing the range.
+         */
+        int32_t threads_;
+
+        /**
+         * @brief The kernel to execute.
+         */
+        K& kernel_;
+
+        /**
+         * @brief The first index of the range not claimed yet.
+         */
+        Atomic<int32_t> next_;
+
+        /**
+         * @brief Worker tasks.
+         */
+        Worker workers_[THREADS_MAX];
+
+    };
+
+    /**
+     * @class ForKernel
+     * @brief Kernel of the parallel for algorithm.
+     *
+     * @tparam B Body type.
+     */
+    template <class B>
+    class ForKernel
+    {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param body The body to execute.
+         */
+        explicit ForKernel(B& body);
+
+        /**
+         * @brief Executes chunks of a loop.
+         *
+         * @param loop  The loop to execute.
+         * @param index The thread index.
+         */
+        void work(Loop<ForKernel>& loop, int32_t index);
+
+    private:
+
+        /**
+         * @brief The body to execute.
+         */
+        B& body_;
+
+    };
+
+    /**
+     * @class ReduceKernel
+     * @brief Kernel of the parallel reduce algorithm.
+     *
+     * @tparam T Value type.
+     * @tparam B Body type.
+     */
+    template <typename T, class B>
+    class ReduceKernel
+    {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param identity The identity value of the reduction.
+         * @param body     The body to execute.
+         */
+        ReduceKernel(T identity, B& body);
+
+        /**
+         * @brief Reduces chunks of a loop.
+         *
+         * @param loop  The loop to execute.
+         * @param index The thread index.
+         */
+        void work(Loop<ReduceKernel>& loop, int32_t index);
+
+        /**
+         * @brief Joins values reduced by threads.
+         *
+         * @param threads Number of threads executed the loop.
+         * @return The reduced value.
+         */
+        T join(int32_t threads);
+
+    private:
+
+        /**
+         * @brief The identity value of the reduction.
+         */
+        T identity_;
+
+        /**
+         * @brief The body to execute.
+         */
+        B& body_;
+
+        /**
+         * @brief Values reduced by each thread.
+         */
+        T values_[THREADS_MAX];
+
+    };
+
+};
+
+template <class B>
+bool_t Parallel::parallelFor(api::Scheduler& scheduler, Range const& range, int32_t grain, B& body)
+{
+    bool_t res( false );
+    if( range.begin <= range.end )
+    {
+        ForKernel<B> kernel( body );
+        Loop< ForKernel<B> > loop( range, grain, kernel );
+        if( loop.isConstructed() )
+        {
+            res = loop.execute(scheduler) > 0;
+        }
+    }
+    return res;
+}
+
+template <typename T, class B>
+bool_t Parallel::parallelReduce(api::Scheduler& scheduler, Range const& range, int32_t grain, T identity, B& body, T& result)
+{
+    bool_t res( false );
+    if( range.begin <= range.end )
+    {
+        ReduceKernel<T,B> kernel( identity, body );
+        Loop< ReduceKernel<T,B> > loop( range, grain, kernel );
+        if( loop.isConstructed() )
+        {
+            int32_t const threads( loop.execute(scheduler) );
+            if( threads > 0 )
+            {
+                result = kernel.join(threads);
+                res = true;
+            }
+        }
+    }
+    return res;
+}
+
+inline Parallel::Range::Range(int32_t aBegin, int32_t aEnd)
+    : begin( aBegin )
+    , end( aEnd ) {
+}
+
+template <class K>
+Parallel::Loop<K>::Loop(Range const& range, int32_t grain, K& kernel)
+    : NonCopyable<NoAllocator>()
+    , end_( range.end )
+    , grain_( (grain > 0) ? grain : 1 )
+    , threads_( 1 )
+    , kernel_( kernel )
+    , next_( range.begin )
+    , workers_() {
+    threads_ = getThreadsNumber();
+}
+
+template <class K>
+Parallel::Loop<K>::~Loop()
+{
+}
+
+template <class K>
+int32_t Parallel::Loop<K>::execute(api::Scheduler& scheduler)
+{
+    api::Thread* threads[THREADS_MAX];
+    int32_t created( 0 );
+    // The calling thread has index zero, others are workers
+    for(int32_t i(1); i < threads_; i++)
+    {
+        workers_[i].bind(this, i);
+        api::Thread* const thread( scheduler.createThread(workers_[i]) );
+        if( thread == NULLPTR )
+        {
+            break;
+        }
+        if( !thread->execute() )
+        {
+            delete thread;
+            break;
+        }
+        threads[created] = thread;
+        created++;
+    }
+    kernel_.work(*this, 0);
+    for(int32_t i(0); i < created; i++)
+    {
+        static_cast<void>( threads[i]->join() );
+        delete threads[i];
+    }
+    return created + 1;
+}
+
+template <class K>
+bool_t Parallel::Loop<K>::claim(Range& chunk)
+{
+    bool_t res( false );
+    int32_t begin( next_.load(Atomic<int32_t>::ORDER_RELAXED) );
+    while( begin < end_ )
+    {
+        // Guided self-scheduling: claim a half of one thread share of the remaining indices
+        int64_t const left( static_cast<int64_t>(end_) - static_cast<int64_t>(begin) );
+        int64_t size( left / static_cast<int64_t>(threads_ * 2) );
+        if( size < static_cast<int64_t>(grain_) )
+        {
+            size = static_cast<int64_t>(grain_);
+        }
+        int32_t const end( (left > size) ? static_cast<int32_t>( static_cast<int64_t>(begin) + size ) : end_ );
+        if( next_.compareExchange(begin, end, Atomic<int32_t>::ORDER_RELAXED) )
+        {
+            chunk.begin = begin;
+            chunk.end = end;
+            res = true;
+            break;
+        }
+    }
+    return res;
+}
+
+template <class K>
+int32_t Parallel::Loop<K>::getThreadsNumber() const
+{
+    int32_t threads( 1 );
+    // The range length may exceed the int32_t range, as the range may span negative and positive indices
+    int64_t const left( static_cast<int64_t>(end_) - static_cast<int64_t>( next_.load(Atomic<int32_t>::ORDER_RELAXED) ) );
+    // Serial cutoff: a range not exceeding the grain is executed by the calling thread only
+    if( left > static_cast<int64_t>(grain_) )
+    {
+        long const cpus( ::sysconf(_SC_NPROCESSORS_ONLN) );
+        if( cpus > 1 )
+        {
+            threads = ( cpus < static_cast<long>(THREADS_MAX) ) ? static_cast<int32_t>(cpus) : THREADS_MAX;
+        }
+        // No more threads than chunks of the grain size
+        int64_t const chunks( (left - 1) / static_cast<int64_t>(grain_) + 1 );
+        if( chunks < static_cast<int64_t>(threads) )
+        {
+            threads = static_cast<int32_t>(chunks);
+        }
+    }
+    return threads;
+}
+
+template <class K>
+Parallel::Loop<K>::Worker::Worker()
+    : NonCopyable<NoAllocator>()
+    , api::Task()
+    , loop_( NULLPTR )
+    , index_( 0 ) {
+}
+
+template <class K>
+Parallel::Loop<K>::Worker::~Worker()
+{
+}
+
+template <class K>
+bool_t Parallel::Loop<K>::Worker::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class K>
+void Parallel::Loop<K>::Worker::start()
+{
+    if( loop_ != NULLPTR )
+    {
+        loop_->kernel_.work(*loop_, index_);
+    }
+}
+
+template <class K>
+size_t Parallel::Loop<K>::Worker::getStackSize() const
+{
+    return 0U;
+}
+
+template <class K>
+void Parallel::Loop<K>::Worker::bind(Loop* loop, int32_t index)
+{
+    loop_ = loop;
+    index_ = index;
+}
+
+template <class B>
+Parallel::ForKernel<B>::ForKernel(B& body)
+    : body_( body ) {
+}
+
+template <class B>
+void Parallel::ForKernel<B>::work(Loop<ForKernel>& loop, int32_t index)
+{
+    static_cast<void>(index); // Avoid MISRA-C++:2008 Rule 0–1–3 and AUTOSAR C++14 Rule A0-1-4
+    Range chunk( 0, 0 );
+    while( loop.claim(chunk) )
+    {
+        body_(chunk);
+    }
+}
+
+template <typename T, class B>
+Parallel::ReduceKernel<T,B>::ReduceKernel(T identity, B& body)
+    : identity_( identity )
+    , body_( body ) {
+}
+
+template <typename T, class B>
+void Parallel::ReduceKernel<T,B>::work(Loop<ReduceKernel>& loop, int32_t index)
+{
+    // Accumulate to a local value not to share cache lines of the values array while executing
+    T value( identity_ );
+    Range chunk( 0, 0 );
+    while( loop.claim(chunk) )
+    {
+        value = body_(chunk, value);
+    }
+    values_[index] = value;
+}
+
+template <typename T, class B>
+T Parallel::ReduceKernel<T,B>::join(int32_t threads)
+{
+    T value( identity_ );
+    for(int32_t i(0); i < threads; i++)
+    {
+        value = body_.join(value, values_[i]);
+    }
+    return value;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_PARALLEL_HPP_
@@ -1,7 +1,7 @@
 /**
  * @file      sys.Posix.hpp
  * @author    Sergey Baigudin, sergey@baigudin.software
- * @copyright 2021-2023, Sergey Baigudin, Baigudin Software
+ * @copyright 2021-2026, Sergey Baigudin, Baigudin Software
  * 
  * @brief POSIX System includes and definitions.
  */
@@ -16,5 +16,15 @@
 #include <unistd.h>
 #include <stdio.h> ///< SCA MISRA-C++:2008 Justified Rule 18-0-1 and Rule 27-0-1
 #include <errno.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <malloc.h>
+#include <alloca.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
 
 #endif // SYS_POSIX_HPP_
@@ -0,0 +1,539 @@
+/**
+ * @file      sys.QueueMutex.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_QUEUEMUTEX_HPP_
+#define SYS_QUEUEMUTEX_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.ConditionMutex.hpp"
+#include "sys.MutexAttributes.hpp"
+#include "sys.Atomic.hpp"
+#include "sys.Futex.hpp"
+#include "sys.Clock.hpp"
+#include "sys.Contention.hpp"
+#include "sys.Backoff.hpp"
+#include "sys.BusyPoll.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class QueueMutex.
+ * @brief MCS queue mutex class.
+ *
+ * Threads waiting for the mutex are queued, and each of them spins on its own queue node,
+ * which is in its own cache line. An unlock hands the mutex off to the next thread in FIFO
+ * order by writing the node of the thread only. A thread spinning for long sleeps on its
+ * node futex.
+ *
+ * @note The mutex type attribute is not applicable, and the mutex does not check errors.
+ *       The mutex is not constructed with a priority protocol, as the owner is not known to the kernel.
+ *       A thread can hold up to NODES queue mutexes at once.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class QueueMutex : public NonCopyable<A>, public ConditionMutex
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    QueueMutex();
+
+    /**
+     * @brief Constructor.
+     *
+     * @param attributes The mutex attributes.
+     */
+    explicit QueueMutex(MutexAttributes const& attributes);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~QueueMutex();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Mutex::tryLock()
+     */
+    virtual bool_t tryLock();
+
+    /**
+     * @copydoc eoos::api::Mutex::lock()
+     */
+    virtual bool_t lock();
+
+    /**
+     * @brief Locks the mutex waiting for a limited time.
+     *
+     * @note A queued thread cannot leave the queue on expiry, thus the thread polls the mutex
+     *       without queuing, and is not served in FIFO order with the queued threads.
+     *
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the mutex has been locked, false if the timeout has expired or an error occurred.
+     */
+    virtual bool_t lock(int64_t timeout);
+
+    /**
+     * @copydoc eoos::api::Mutex::unlock()
+     */
+    virtual bool_t unlock();
+
+    /**
+     * @copydoc eoos::sys::ConditionMutex::getRequeueWord()
+     */
+    virtual int32_t* getRequeueWord();
+
+    /**
+     * @copydoc eoos::sys::ConditionMutex::lockRequeued()
+     */
+    virtual bool_t lockRequeued();
+
+    /**
+     * @brief Maximum number of queue mutexes held by a thread at once.
+     */
+    static const int32_t NODES = 16;
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @enum State
+     * @brief State of a queue node.
+     */
+    enum State
+    {
+        STATE_WAITING = 0, ///< @brief The thread spins for the mutex.
+        STATE_GRANTED = 1, ///< @brief The mutex is handed off to the thread.
+        STATE_PARKED  = 2  ///< @brief The thread sleeps for the mutex.
+    };
+
+    /**
+     * @brief Cache line size in bytes.
+     */
+    static const int32_t CACHE_LINE = 64;
+
+    /**
+     * @brief Default number of spin iterations before sleeping.
+     */
+    static const int32_t SPINS_MAX = 100;
+
+    /**
+     * @struct Node
+     * @brief Queue node of a thread aligned to and occupying a whole cache line.
+     *
+     * @note Fields are accessed by atomic built-ins, as nodes are thread-local plain data.
+     */
+    struct Node
+    {
+        /**
+         * @brief Next node in the queue.
+         */
+        Node* next;
+
+        /**
+         * @brief The node state.
+         */
+        int32_t state;
+
+        /**
+         * @brief Padding to the cache line size.
+         */
+        uint8_t padding[CACHE_LINE - sizeof(Node*) - sizeof(int32_t)];
+    } __attribute__((aligned(CACHE_LINE)));
+
+    /**
+     * @brief Maximum time of sleeping between polls of a timed lock in nanoseconds.
+     */
+    static const int64_t POLL_MAX = 1000000;
+
+    /**
+     * @brief Locks the mutex if it is unlocked.
+     *
+     * @return True if the mutex has been locked.
+     */
+    bool_t take();
+
+    /**
+     * @brief Takes a free node of the calling thread.
+     *
+     * @return The node, or NULLPTR if all the nodes are taken.
+     */
+    static Node* takeNode();
+
+    /**
+     * @brief Gives a node back to the calling thread.
+     *
+     * @param node The node.
+     */
+    static void giveNode(Node* node);
+
+    /**
+     * @brief Waits until the mutex is handed off to a node.
+     *
+     * @param node The node.
+     */
+    void wait(Node* node) const;
+
+    /**
+     * @brief Records a lock of the mutex to the contention profiler.
+     *
+     * @param start       Time the wait has started at.
+     * @param isContended True if the mutex has not been locked at once.
+     * @param site        The call site.
+     */
+    void onLock(int64_t start, bool_t isContended, void const* site);
+
+    /**
+     * @brief Records a failed lock of the mutex to the contention profiler.
+     *
+     * @param site The call site.
+     */
+    void onFail(void const* site) const;
+
+    /**
+     * @brief Nodes of a thread.
+     */
+    static __thread Node nodes_[NODES];
+
+    /**
+     * @brief Bit mask of taken nodes of a thread.
+     */
+    static __thread uint32_t taken_;
+
+    /**
+     * @brief The last node in the queue, or NULLPTR if the mutex is unlocked.
+     */
+    Atomic<Node*> tail_;
+
+    /**
+     * @brief The node of the mutex owner.
+     */
+    Node* owner_;
+
+    /**
+     * @brief Maximum number of spin iterations before sleeping.
+     */
+    int32_t spinsMax_;
+
+    /**
+     * @brief Time the mutex has been locked at for the contention profiler.
+     */
+    int64_t lockedAt_;
+
+};
+
+template <class A>
+__thread typename QueueMutex<A>::Node QueueMutex<A>::nodes_[NODES];
+
+template <class A>
+__thread uint32_t QueueMutex<A>::taken_( 0U );
+
+template <class A>
+QueueMutex<A>::QueueMutex()
+    : NonCopyable<A>()
+    , ConditionMutex()
+    , tail_( NULLPTR )
+    , owner_( NULLPTR )
+    , spinsMax_( SPINS_MAX )
+    , lockedAt_( 0 ) {
+}
+
+template <class A>
+QueueMutex<A>::QueueMutex(MutexAttributes const& attributes)
+    : NonCopyable<A>()
+    , ConditionMutex()
+    , tail_( NULLPTR )
+    , owner_( NULLPTR )
+    , spinsMax_( (attributes.spins >= 0) ? attributes.spins : SPINS_MAX )
+    , lockedAt_( 0 ) {
+    bool_t const isConstructed( attributes.protocol == MutexAttributes::PROTOCOL_NONE );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+QueueMutex<A>::~QueueMutex()
+{
+    #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    Contention::onDestroy(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX);
+    #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+}
+
+template <class A>
+bool_t QueueMutex<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t QueueMutex<A>::tryLock()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = take();
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( res )
+        {
+            onLock(0, false, __builtin_return_address(0));
+        }
+        else
+        {
+            onFail(__builtin_return_address(0));
+        }
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t QueueMutex<A>::lock()
+{
+    bool_t res( false );
+    Node* const node( isConstructed() ? takeNode() : NULLPTR );
+    if( node != NULLPTR )
+    {
+        node->next = NULLPTR;
+        node->state = STATE_WAITING;
+        Node* const prev( tail_.exchange(node, Atomic<Node*>::ORDER_ACQ_REL) );
+        bool_t const isContended( prev != NULLPTR );
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        int64_t const start( isContended ? Clock::getTime() : 0 );
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( isContended )
+        {
+            // Link to the previous node, and wait for the previous owner hands the mutex off
+            __atomic_store_n(&prev->next, node, __ATOMIC_RELEASE);
+            wait(node);
+        }
+        owner_ = node;
+        res = true;
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        onLock(start, isContended, __builtin_return_address(0));
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    else if( isConstructed() )
+    {   ///< UT Justified Branch: A thread holds NODES queue mutexes
+        onFail(__builtin_return_address(0));
+    }
+    #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    return res;
+}
+
+template <class A>
+bool_t QueueMutex<A>::lock(int64_t const timeout)
+{
+    bool_t res( false );
+    if( timeout < 0 )
+    {
+        res = lock();
+    }
+    else if( isConstructed() )
+    {
+        res = take();
+        bool_t const isContended( !res );
+        int64_t const start( isContended ? Clock::getTime() : 0 );
+        int64_t const deadline( start + timeout );
+        int64_t interval( 1000 );
+        bool_t isExpired( false );
+        for(int32_t count(0); !res && !isExpired; count += (count < spinsMax_) ? 1 : 0)
+        {
+            if( (count < spinsMax_) || BusyPoll::isEnabled() )
+            {
+                Backoff::relax();
+            }
+            else
+            {
+                // Sleep for doubling periods, as no owner wakes up a thread not queued
+                int64_t const left( deadline - Clock::getTime() );
+                int64_t const period( (interval < left) ? interval : left );
+                if( period > 0 )
+                {
+                    ::timespec const time = { static_cast< ::time_t >(period / 1000000000LL), static_cast<long>(period % 1000000000LL) };
+                    static_cast<void>( ::nanosleep(&time, NULLPTR) );
+                }
+                interval = (interval * 2 < POLL_MAX) ? (interval * 2) : POLL_MAX;
+            }
+            res = take();
+            if( !res )
+            {
+                isExpired = Clock::getTime() >= deadline;
+            }
+        }
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( res )
+        {
+            onLock(start, isContended, __builtin_return_address(0));
+        }
+        else
+        {
+            onFail(__builtin_return_address(0));
+        }
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t QueueMutex<A>::unlock()
+{
+    bool_t res( false );
+    if( isConstructed() && (owner_ != NULLPTR) )
+    {
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        Contention::onRelease(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX, Clock::getTime() - lockedAt_);
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        Node* const node( owner_ );
+        owner_ = NULLPTR;
+        Node* next( __atomic_load_n(&node->next, __ATOMIC_ACQUIRE) );
+        if( next == NULLPTR )
+        {
+            Node* expected( node );
+            if( !tail_.compareExchange(expected, NULLPTR, Atomic<Node*>::ORDER_ACQ_REL) )
+            {
+                // A thread has swapped the tail, and is about to link its node
+                Backoff backoff;
+                while( (next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE)) == NULLPTR )
+                {
+                    if( !backoff.isSaturated() )
+                    {
+                        backoff.pause();
+                    }
+                    else
+                    {
+                        static_cast<void>( ::sched_yield() );
+                    }
+                }
+            }
+        }
+        if( next != NULLPTR )
+        {
+            if( __atomic_exchange_n(&next->state, STATE_GRANTED, __ATOMIC_RELEASE) == STATE_PARKED )
+            {
+                static_cast<void>( Futex::wake(&next->state, 1) );
+            }
+        }
+        giveNode(node);
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+int32_t* QueueMutex<A>::getRequeueWord()
+{
+    return NULLPTR;
+}
+
+template <class A>
+bool_t QueueMutex<A>::lockRequeued()
+{
+    return lock();
+}
+
+template <class A>
+bool_t QueueMutex<A>::take()
+{
+    bool_t res( false );
+    Node* const node( takeNode() );
+    if( node != NULLPTR )
+    {
+        node->next = NULLPTR;
+        node->state = STATE_GRANTED;
+        Node* expected( NULLPTR );
+        res = tail_.compareExchange(expected, node, Atomic<Node*>::ORDER_ACQ_REL);
+        if( res )
+        {
+            owner_ = node;
+        }
+        else
+        {
+            giveNode(node);
+        }
+    }
+    return res;
+}
+
+template <class A>
+typename QueueMutex<A>::Node* QueueMutex<A>::takeNode()
+{
+    Node* node( NULLPTR );
+    uint32_t const free( ~taken_ );
+    if( free != 0U )
+    {
+        int32_t const index( __builtin_ctz(free) );
+        if( index < NODES )
+        {
+            taken_ |= (1U << index);
+            node = &nodes_[index];
+        }
+    }
+    return node;
+}
+
+template <class A>
+void QueueMutex<A>::giveNode(Node* const node)
+{
+    int32_t const index( static_cast<int32_t>(node - &nodes_[0]) );
+    taken_ &= ~(1U << index);
+}
+
+template <class A>
+void QueueMutex<A>::wait(Node* const node) const
+{
+    bool_t const isBusyPoll( BusyPoll::isEnabled() );
+    int32_t count( 0 );
+    while( __atomic_load_n(&node->state, __ATOMIC_ACQUIRE) != STATE_GRANTED )
+    {
+        // Spin without backoff, as only the previous owner writes the node
+        if( isBusyPoll || (count < spinsMax_) )
+        {
+            Backoff::relax();
+            count++;
+        }
+        else
+        {
+            // Mark the node as parked, so the previous owner wakes the thread up on unlock
+            int32_t expected( STATE_WAITING );
+            if( __atomic_compare_exchange_n(&node->state, &expected, STATE_PARKED, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)
+             || (expected == STATE_PARKED) )
+            {
+                static_cast<void>( Futex::wait(&node->state, STATE_PARKED) );
+            }
+        }
+    }
+}
+
+template <class A>
+void QueueMutex<A>::onLock(int64_t const start, bool_t const isContended, void const* const site)
+{
+    lockedAt_ = Clock::getTime();
+    int64_t const wait( isContended ? (lockedAt_ - start) : 0 );
+    Contention::onAcquire(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX, wait, isContended, site);
+}
+
+template <class A>
+void QueueMutex<A>::onFail(void const* const site) const
+{
+    Contention::onFail(static_cast<api::Mutex const*>(this), Contention::KIND_MUTEX, site);
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_QUEUEMUTEX_HPP_
@@ -0,0 +1,487 @@
+/**
+ * @file      sys.RwLock.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RWLOCK_HPP_
+#define SYS_RWLOCK_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.RwLockAttributes.hpp"
+#include "sys.FutexMutex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class RwLock
+ * @brief Reader-writer lock class.
+ *
+ * Readers count themselves in counters sharded by CPUs, each counter is in its own cache line,
+ * thus readers on different CPUs do not write to the same cache line. A writer announces itself
+ * in a word which readers only read while there is no writer, and waits for all the counters
+ * get zero.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class RwLock : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    RwLock();
+
+    /**
+     * @brief Constructor.
+     *
+     * @param attributes The lock attributes.
+     */
+    explicit RwLock(RwLockAttributes const& attributes);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~RwLock();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Tries to lock the lock for reading.
+     *
+     * @return True if the lock has been locked.
+     */
+    bool_t tryLockRead();
+
+    /**
+     * @brief Locks the lock for reading.
+     *
+     * @return True if the lock has been locked.
+     */
+    bool_t lockRead();
+
+    /**
+     * @brief Unlocks the lock locked for reading.
+     *
+     * @return True if the lock has been unlocked.
+     */
+    bool_t unlockRead();
+
+    /**
+     * @brief Tries to lock the lock for writing.
+     *
+     * @return True if the lock has been locked.
+     */
+    bool_t tryLockWrite();
+
+    /**
+     * @brief Locks the lock for writing.
+     *
+     * @return True if the lock has been locked.
+     */
+    bool_t lockWrite();
+
+    /**
+     * @brief Unlocks the lock locked for writing.
+     *
+     * @return True if the lock has been unlocked.
+     */
+    bool_t unlockWrite();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @enum State
+     * @brief State of the writer word.
+     */
+    enum State
+    {
+        STATE_FREE    = 0, ///< @brief No writer.
+        STATE_WRITER  = 1, ///< @brief A writer owns or waits for the lock.
+        STATE_WAITED  = 2, ///< @brief A writer owns or waits for the lock, and readers may sleep.
+        STATE_DRAINED = 3  ///< @brief A writer not blocking readers sleeps waiting for the readers leave.
+    };
+
+    /**
+     * @brief Number of yields of a writer not blocking readers before sleeping.
+     */
+    static const int32_t YIELDS_MAX = 16;
+
+    /**
+     * @brief Number of reader counters.
+     */
+    static const int32_t SHARDS = EOOS_GLOBAL_SYS_RWLOCK_SHARDS;
+
+    /**
+     * @brief Cache line size in bytes.
+     */
+    static const int32_t CACHE_LINE = 64;
+
+    /**
+     * @struct Shard
+     * @brief Reader counter occupying a whole cache line.
+     */
+    struct Shard
+    {
+        /**
+         * @brief Constructor.
+         */
+        Shard();
+
+        /**
+         * @brief Number of readers.
+         */
+        Atomic<int32_t> readers;
+
+        /**
+         * @brief Padding to the cache line size.
+         */
+        uint8_t padding[CACHE_LINE - sizeof(Atomic<int32_t>)];
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Returns the counter index of the calling thread.
+     *
+     * @return The counter index.
+     */
+    static int32_t getShard();
+
+    /**
+     * @brief Tries to count the calling thread as a reader.
+     *
+     * @return True if the reader has been counted and there is no writer.
+     */
+    bool_t tryEnter();
+
+    /**
+     * @brief Uncounts a reader from a counter.
+     *
+     * @param shard The counter index.
+     */
+    void leave(int32_t shard);
+
+    /**
+     * @brief Returns number of readers.
+     *
+     * @return Sum of all the counters.
+     */
+    int32_t getReaders() const;
+
+    /**
+     * @brief Waits for all the readers leave.
+     */
+    void drain();
+
+    /**
+     * @brief Removes the writer and wakes sleeping readers up.
+     */
+    void release();
+
+    /**
+     * @brief Reader counters.
+     */
+    Shard shards_[SHARDS];
+
+    /**
+     * @brief The writer word.
+     */
+    Atomic<int32_t> writer_;
+
+    /**
+     * @brief Sequence of readers leaving while a writer is waiting.
+     */
+    Atomic<int32_t> drain_;
+
+    /**
+     * @brief Writers guard.
+     */
+    FutexMutex<NoAllocator> mutex_;
+
+    /**
+     * @brief Writer preference flag.
+     */
+    bool_t isWriterPreferred_;
+
+};
+
+template <class A>
+RwLock<A>::RwLock()
+    : NonCopyable<A>()
+    , shards_()
+    , writer_( STATE_FREE )
+    , drain_( 0 )
+    , mutex_()
+    , isWriterPreferred_( false ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+RwLock<A>::RwLock(RwLockAttributes const& attributes)
+    : NonCopyable<A>()
+    , shards_()
+    , writer_( STATE_FREE )
+    , drain_( 0 )
+    , mutex_()
+    , isWriterPreferred_( attributes.isWriterPreferred ) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+RwLock<A>::~RwLock()
+{
+}
+
+template <class A>
+bool_t RwLock<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t RwLock<A>::tryLockRead()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = tryEnter();
+    }
+    return res;
+}
+
+template <class A>
+bool_t RwLock<A>::lockRead()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        while( !tryEnter() )
+        {
+            // Mark the writer word, so the writer wakes the readers up on unlock
+            int32_t state( STATE_WRITER );
+            if( writer_.compareExchange(state, STATE_WAITED) || (state == STATE_WAITED) )
+            {
+                static_cast<void>( Futex::wait(writer_.getAddress(), STATE_WAITED) );
+            }
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t RwLock<A>::unlockRead()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        // The counter may differ from the one counted on if the thread has migrated, but the sum is kept
+        leave( getShard() );
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t RwLock<A>::tryLockWrite()
+{
+    bool_t res( false );
+    if( isConstructed() && mutex_.tryLock() )
+    {
+        writer_.store(STATE_WRITER);
+        if( getReaders() == 0 )
+        {
+            res = true;
+        }
+        else
+        {
+            release();
+            static_cast<void>( mutex_.unlock() );
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t RwLock<A>::lockWrite()
+{
+    bool_t res( false );
+    if( isConstructed() && mutex_.lock() )
+    {
+        if( isWriterPreferred_ )
+        {
+            // Block new readers first, and then wait for the current readers leave
+            writer_.store(STATE_WRITER);
+            drain();
+        }
+        else
+        {
+            // Take the lock only when there are no readers, and give way to readers came meanwhile
+            while( true )
+            {
+                drain();
+                writer_.store(STATE_WRITER);
+                if( getReaders() == 0 )
+                {
+                    break;
+                }
+                release();
+            }
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t RwLock<A>::unlockWrite()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        release();
+        res = mutex_.unlock();
+    }
+    return res;
+}
+
+template <class A>
+bool_t RwLock<A>::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = mutex_.isConstructed();
+    }
+    return res;
+}
+
+template <class A>
+int32_t RwLock<A>::getShard()
+{
+    int_t const cpu( ::sched_getcpu() );
+    return (cpu > 0) ? (static_cast<int32_t>(cpu) % SHARDS) : 0;
+}
+
+template <class A>
+bool_t RwLock<A>::tryEnter()
+{
+    bool_t res( true );
+    int32_t const shard( getShard() );
+    static_cast<void>( shards_[shard].readers.fetchAdd(1) );
+    int32_t const state( writer_.load() );
+    if( (state == STATE_WRITER) || (state == STATE_WAITED) )
+    {
+        // Leave the same counter as the writer may have read the counter incremented
+        leave(shard);
+        res = false;
+    }
+    return res;
+}
+
+template <class A>
+void RwLock<A>::leave(int32_t const shard)
+{
+    static_cast<void>( shards_[shard].readers.fetchSub(1) );
+    int32_t const state( writer_.load() );
+    if( (state == STATE_WAITED) || (state == STATE_DRAINED) )
+    {
+        // A writer may sleep waiting for the readers leave
+        static_cast<void>( drain_.fetchAdd(1) );
+        static_cast<void>( Futex::wake(drain_.getAddress(), 1) );
+    }
+}
+
+template <class A>
+int32_t RwLock<A>::getReaders() const
+{
+    int32_t readers( 0 );
+    for(int32_t i(0); i < SHARDS; i++)
+    {
+        readers += shards_[i].readers.load();
+    }
+    return readers;
+}
+
+template <class A>
+void RwLock<A>::drain()
+{
+    Backoff backoff;
+    bool_t isWaited( false );
+    int32_t yields( 0 );
+    while( true )
+    {
+        int32_t const sequence( drain_.load() );
+        if( getReaders() == 0 )
+        {
+            break;
+        }
+        if( !backoff.isSaturated() )
+        {
+            backoff.pause();
+        }
+        else if( isWaited )
+        {
+            static_cast<void>( Futex::wait(drain_.getAddress(), sequence) );
+        }
+        else
+        {
+            // Readers leaving bump the sequence only if they see the word marked, thus the readers
+            // are counted again after the marking before the writer sleeps
+            int32_t state( STATE_WRITER );
+            isWaited = writer_.compareExchange(state, STATE_WAITED) || (state == STATE_WAITED);
+            if( !isWaited && (yields < YIELDS_MAX) )
+            {
+                // The writer does not block readers, which bump the sequence only after the word is marked drained
+                static_cast<void>( ::sched_yield() );
+                yields++;
+            }
+            else if( !isWaited )
+            {
+                // Readers keep entering, as the drained word does not block them
+                state = STATE_FREE;
+                isWaited = writer_.compareExchange(state, STATE_DRAINED) || (state == STATE_DRAINED);
+            }
+        }
+    }
+}
+
+template <class A>
+void RwLock<A>::release()
+{
+    if( writer_.exchange(STATE_FREE) == STATE_WAITED )
+    {
+        static_cast<void>( Futex::wake(writer_.getAddress(), 0x7FFFFFFF) );
+    }
+}
+
+template <class A>
+RwLock<A>::Shard::Shard()
+    : readers( 0 )
+    , padding() {
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RWLOCK_HPP_
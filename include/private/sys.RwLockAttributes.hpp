@@ -0,0 +1,44 @@
+/**
+ * @file      sys.RwLockAttributes.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RWLOCKATTRIBUTES_HPP_
+#define SYS_RWLOCKATTRIBUTES_HPP_
+
+#include "sys.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @struct RwLockAttributes
+ * @brief Attributes of a reader-writer lock.
+ */
+struct RwLockAttributes
+{
+
+    /**
+     * @brief Constructor of default attributes.
+     */
+    RwLockAttributes();
+
+    /**
+     * @brief Writer preference flag.
+     *
+     * If the flag is set, a writer waiting for the lock blocks new readers, otherwise new readers
+     * take the lock while there are other readers and a writer may wait for the lock infinitely.
+     */
+    bool_t isWriterPreferred;
+
+};
+
+inline RwLockAttributes::RwLockAttributes()
+    : isWriterPreferred( false ) {
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RWLOCKATTRIBUTES_HPP_
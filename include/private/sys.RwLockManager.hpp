@@ -0,0 +1,135 @@
+/**
+ * @file      sys.RwLockManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RWLOCKMANAGER_HPP_
+#define SYS_RWLOCKMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.RwLock.hpp"
+#include "sys.LockFreePool.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class RwLockManager.
+ * @brief Reader-writer lock sub-system manager.
+ */
+class RwLockManager : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+    typedef RwLock<RwLockManager> Resource;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    RwLockManager();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~RwLockManager();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Creates a new reader-writer lock resource.
+     *
+     * @return A new reader-writer lock resource, or NULLPTR if an error has been occurred.
+     */
+    RwLock<RwLockManager>* create();
+
+    /**
+     * @brief Creates a new reader-writer lock resource with attributes.
+     *
+     * @param attributes The lock attributes.
+     * @return A new reader-writer lock resource, or NULLPTR if an error has been occurred.
+     */
+    RwLock<RwLockManager>* create(RwLockAttributes const& attributes);
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees allocated memory.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * Constructs this object.
+     *
+     * @return true if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Initializes the allocator with heap for resource allocation.
+     *
+     * @param resource Heap for resource allocation.
+     * @return True if initialized.
+     */
+    static bool_t initialize(api::Heap* resource);
+
+    /**
+     * @brief Initializes the allocator.
+     */
+    static void deinitialize();
+
+    /**
+     * @struct ResourcePool
+     * @brief Resource memory pool.
+     */
+    struct ResourcePool
+    {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        ResourcePool();
+
+        /**
+         * @brief Reader-writer lock memory allocator.
+         */
+        LockFreePool<Resource,EOOS_GLOBAL_SYS_RWLOCK_AMOUNT> memory;
+
+    };
+
+    /**
+     * @brief Heap for resource allocation.
+     */
+    static api::Heap* resource_;
+
+    /**
+     * @brief Resource memory pool.
+     */
+    ResourcePool pool_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RWLOCKMANAGER_HPP_
@@ -9,8 +9,7 @@
 #include "sys.NonCopyable.hpp"
 #include "api.Scheduler.hpp"
 #include "sys.Thread.hpp"
-#include "sys.Mutex.hpp"
-#include "lib.MemoryPool.hpp"
+#include "sys.LockFreePool.hpp"
 
 namespace eoos
 {
@@ -28,6 +27,16 @@ class Scheduler : public NonCopyable<NoAllocator>, public api::Scheduler
 
 public:
 
+    /**
+     * @brief Size of storage for a thread resource.
+     */
+    static const size_t STORAGE_SIZE = sizeof(Resource);
+
+    /**
+     * @brief Alignment of storage for a thread resource.
+     */
+    static const size_t STORAGE_ALIGNMENT = __alignof__(Resource);
+
     /**
      * @brief Constructor.
      */
@@ -48,6 +57,37 @@ public:
      */
     virtual api::Thread* createThread(api::Task& task);
 
+    /**
+     * @brief Creates a new thread in caller storage.
+     *
+     * @note The thread shall be destroyed by the destroyThread() function, and not deleted.
+     *
+     * @param storage Storage of STORAGE_SIZE bytes aligned to STORAGE_ALIGNMENT.
+     * @param task    An task interface whose start() method is invoked when the thread is executed.
+     * @return A new thread, or NULLPTR if an error has been occurred.
+     */
+    api::Thread* createThread(void* storage, api::Task& task);
+
+    /**
+     * @brief Destroys a thread created in caller storage.
+     *
+     * @param thread The thread, or NULLPTR.
+     */
+    void destroyThread(api::Thread* thread);
+
+    /**
+     * @brief Creates a new thread dedicated to a CPU.
+     *
+     * The thread is pinned to the CPU and runs in the busy-poll mode, in which it waits for
+     * mutexes and semaphores in a spin-wait loop instead of sleeping in the kernel. The CPU
+     * is expected to be isolated from other threads of the system.
+     *
+     * @param task An task interface whose start() method is invoked when the thread is executed.
+     * @param cpu  The CPU to dedicate to the thread.
+     * @return A new thread, or NULLPTR if an error has been occurred.
+     */
+    api::Thread* createDedicatedThread(api::Task& task, int32_t cpu);
+
     /**
      * @copydoc eoos::api::Scheduler::sleep(int32_t)
      */
@@ -142,19 +182,10 @@ private:
          */
         ResourcePool();
 
-    private:
-
-        /**
-         * @brief Mutex resource.
-         */
-        Mutex<NoAllocator> mutex_;
-
-    public:
-
         /**
          * @brief Resource memory allocator.
          */
-        lib::MemoryPool<Resource,EOOS_GLOBAL_SYS_THREAD_AMOUNT> memory;
+        LockFreePool<Resource,EOOS_GLOBAL_SYS_THREAD_AMOUNT> memory;
 
     };
 
@@ -1,13 +1,18 @@
 /**
  * @file      sys.Semaphore.hpp
  * @author    Sergey Baigudin, sergey@baigudin.software
- * @copyright 2017-2023, Sergey Baigudin, Baigudin Software
+ * @copyright 2017-2026, Sergey Baigudin, Baigudin Software
  */
 #ifndef SYS_SEMAPHORE_HPP_
 #define SYS_SEMAPHORE_HPP_
 
 #include "sys.NonCopyable.hpp"
-#include "api.Semaphore.hpp"
+#include "sys.CountingSemaphore.hpp"
+#include "sys.BusyPoll.hpp"
+#include "sys.Backoff.hpp"
+#include "sys.Clock.hpp"
+#include "sys.Contention.hpp"
+#include "sys.FutexMutex.hpp"
 
 namespace eoos
 {
@@ -17,11 +22,17 @@ namespace sys
 /**
  * @class Semaphore
  * @brief Semaphore class.
+ *
+ * @note A POSIX semaphore changes its count by one permit per call, thus a number of permits
+ *       is acquired or released by a call per permit, and the change is not atomic. Acquisitions
+ *       of a number of permits are serialized in the process by a mutex local to the process, and
+ *       fail on a semaphore shared between processes or named, which the mutex does not serialize.
+ *       A thread acquiring one permit may take it between permits taken by an acquisition of a number.
  * 
  * @tparam A Heap memory allocator class.
  */
 template <class A>
-class Semaphore : public NonCopyable<A>, public api::Semaphore
+class Semaphore : public NonCopyable<A>, public CountingSemaphore
 {
     typedef NonCopyable<A> Parent;
 
@@ -34,6 +45,41 @@ public:
      */
     explicit Semaphore(int32_t permits);
 
+    /**
+     * @brief Constructor of a semaphore shared between processes.
+     *
+     * The semaphore is initialized in shared memory, and the destructor destroys it.
+     *
+     * @param permits The initial number of permits available.
+     * @param shared  The semaphore memory in memory shared between processes.
+     */
+    Semaphore(int32_t permits, ::sem_t* shared);
+
+    /**
+     * @brief Constructor of a semaphore shared between processes initialized by another process.
+     *
+     * @param shared The semaphore memory in memory shared between processes.
+     */
+    explicit Semaphore(::sem_t* shared);
+
+    /**
+     * @brief Constructor of a named semaphore shared between processes.
+     *
+     * The semaphore is created, and fails to be constructed if a semaphore of the name exists.
+     * The destructor closes the semaphore, which exists until its name is unlinked.
+     *
+     * @param name    The name of the semaphore, which is a slash followed by characters not slashes.
+     * @param permits The initial number of permits available.
+     */
+    Semaphore(char_t const* name, int32_t permits);
+
+    /**
+     * @brief Constructor of a named semaphore shared between processes created by another process.
+     *
+     * @param name The name of the semaphore.
+     */
+    explicit Semaphore(char_t const* name);
+
     /**
      * @brief Destructor.
      */
@@ -49,11 +95,50 @@ public:
      */
     virtual bool_t acquire();
 
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(int64_t)
+     */
+    virtual bool_t acquire(int64_t timeout);
+
+    /**
+     * @brief Acquires a number of permits waiting for a limited time.
+     *
+     * @note The permits are taken one by one, and acquisitions of a number of permits are serialized,
+     *       thus two of them do not deadlock each holding a part of permits. A semaphore shared between
+     *       processes or named fails an acquisition of more than one permit.
+     *
+     * @param permits The number of permits.
+     * @param timeout Relative timeout in nanoseconds, or Clock::TIMEOUT_INFINITE.
+     * @return True if the permits have been acquired, false if the timeout has expired or an error occurred.
+     */
+    virtual bool_t acquire(int32_t permits, int64_t timeout);
+
+    /**
+     * @brief Acquires a number of permits if they are available.
+     *
+     * @note The acquisition fails if another acquisition of a number of permits is in progress.
+     *       A semaphore shared between processes or named fails an acquisition of more than one permit.
+     *
+     * @param permits The number of permits.
+     * @return True if the permits have been acquired.
+     */
+    virtual bool_t tryAcquire(int32_t permits);
+
     /**
      * @copydoc eoos::api::Semaphore::release()
      */
     virtual bool_t release();
 
+    /**
+     * @brief Releases a number of permits.
+     *
+     * @note The permits are posted one by one, and each of them wakes up one waiting thread.
+     *
+     * @param permits The number of permits.
+     * @return True if the permits have been released.
+     */
+    virtual bool_t release(int32_t permits);
+
 protected:
 
     using Parent::setConstructed;
@@ -74,11 +159,38 @@ private:
      */
     bool_t initialize();
 
+    /**
+     * @brief Waits for the POSIX semaphore until a CLOCK_MONOTONIC deadline.
+     *
+     * @param timeout Relative timeout in nanoseconds.
+     * @return Zero on success, or -1 with errno set.
+     */
+    int_t waitTimed(int64_t timeout);
+
     /**
      * @brief Deinitializes kernel semaphore resource.
      */
     void deinitialize();
 
+    /**
+     * @brief Opens a named semaphore.
+     *
+     * @param name    The name of the semaphore.
+     * @param flags   O_CREAT and O_EXCL to create the semaphore, or zero to open an existing one.
+     * @param permits The initial number of permits available of a semaphore created.
+     * @return The semaphore, or NULLPTR if an error has been occurred.
+     */
+    static ::sem_t* open(char_t const* name, int_t flags, int32_t permits);
+
+    /**
+     * @brief Records an acquisition of the semaphore to the contention profiler.
+     *
+     * @param start       Time the wait has started at.
+     * @param isContended True if the permit has not been acquired at once.
+     * @param site        The call site.
+     */
+    void onAcquire(int64_t start, bool_t isContended, void const* site) const;
+
     /**
      * @brief Test if semaphore is fair.
      *
@@ -101,22 +213,110 @@ private:
      */
     ::sem_t sem_;    
 
+    /**
+     * @brief The semaphore used, which is this semaphore resource or a semaphore in shared memory.
+     */
+    ::sem_t* handle_;
+
+    /**
+     * @brief The semaphore is initialized by this object.
+     */
+    bool_t isOwner_;
+
+    /**
+     * @brief The semaphore is a named semaphore opened by this object.
+     */
+    bool_t isNamed_;
+
+    /**
+     * @brief Mutex serializing acquisitions of a number of permits, which is not used by semaphores
+     *        shared between processes or named.
+     */
+    FutexMutex<NoAllocator> batch_;
+
 };
 
 template <class A>
 Semaphore<A>::Semaphore(int32_t permits) 
     : NonCopyable<A>()
-    , api::Semaphore()
+    , CountingSemaphore()
     , isFair_(false)
     , permits_(permits)
-    , sem_(){
+    , sem_()
+    , handle_( &sem_ )
+    , isOwner_( true )
+    , isNamed_( false )
+    , batch_() {
     bool_t const isConstructed( construct() );
     setConstructed( isConstructed );
 }
 
+template <class A>
+Semaphore<A>::Semaphore(int32_t const permits, ::sem_t* const shared)
+    : NonCopyable<A>()
+    , CountingSemaphore()
+    , isFair_( false )
+    , permits_( permits )
+    , sem_()
+    , handle_( shared )
+    , isOwner_( true )
+    , isNamed_( false )
+    , batch_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+Semaphore<A>::Semaphore(::sem_t* const shared)
+    : NonCopyable<A>()
+    , CountingSemaphore()
+    , isFair_( false )
+    , permits_( 0 )
+    , sem_()
+    , handle_( shared )
+    , isOwner_( false )
+    , isNamed_( false )
+    , batch_() {
+    bool_t const isConstructed( handle_ != NULLPTR );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+Semaphore<A>::Semaphore(char_t const* const name, int32_t const permits)
+    : NonCopyable<A>()
+    , CountingSemaphore()
+    , isFair_( false )
+    , permits_( permits )
+    , sem_()
+    , handle_( open(name, O_CREAT | O_EXCL, permits) )
+    , isOwner_( false )
+    , isNamed_( true )
+    , batch_() {
+    bool_t const isConstructed( handle_ != NULLPTR );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+Semaphore<A>::Semaphore(char_t const* const name)
+    : NonCopyable<A>()
+    , CountingSemaphore()
+    , isFair_( false )
+    , permits_( 0 )
+    , sem_()
+    , handle_( open(name, 0, 0) )
+    , isOwner_( false )
+    , isNamed_( true )
+    , batch_() {
+    bool_t const isConstructed( handle_ != NULLPTR );
+    setConstructed( isConstructed );
+}
+
 template <class A>
 Semaphore<A>::~Semaphore()
 {
+    #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    Contention::onDestroy(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE);
+    #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
     deinitialize();
 }
 
@@ -132,10 +332,164 @@ bool_t Semaphore<A>::acquire()
     bool_t res( false );
     if( isConstructed() )
     {
-        int_t const error( ::sem_wait(&sem_) );
+        int_t error( -1 );
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        error = ::sem_trywait(handle_);
+        bool_t const isContended( error != 0 );
+        int64_t const start( isContended ? Clock::getTime() : 0 );
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( error != 0 )
+        {
+            if( BusyPoll::isEnabled() )
+            {
+                Backoff backoff;
+                error = ::sem_trywait(handle_);
+                while( (error != 0) && ( (errno == EAGAIN) || (errno == EINTR) ) )
+                {
+                    backoff.pause();
+                    error = ::sem_trywait(handle_);
+                }
+            }
+            else
+            {
+                error = ::sem_wait(handle_);
+            }
+        }
         if( error == 0 ) 
         { 
             res = true; 
+            #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+            onAcquire(start, isContended, __builtin_return_address(0));
+            #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t Semaphore<A>::acquire(int64_t const timeout)
+{
+    bool_t res( false );
+    if( timeout < 0 )
+    {
+        res = acquire();
+    }
+    else if( isConstructed() )
+    {
+        int_t error( ::sem_trywait(handle_) );
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        bool_t const isContended( error != 0 );
+        int64_t const start( isContended ? Clock::getTime() : 0 );
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        if( (error != 0) && ( (errno == EAGAIN) || (errno == EINTR) ) )
+        {
+            if( BusyPoll::isEnabled() )
+            {
+                Backoff backoff;
+                int64_t const deadline( Clock::getTime() + timeout );
+                while( (error != 0) && ( (errno == EAGAIN) || (errno == EINTR) ) && (Clock::getTime() < deadline) )
+                {
+                    backoff.pause();
+                    error = ::sem_trywait(handle_);
+                }
+            }
+            else
+            {
+                error = waitTimed(timeout);
+            }
+        }
+        if( error == 0 )
+        {
+            res = true;
+            #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+            onAcquire(start, isContended, __builtin_return_address(0));
+            #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        }
+        #ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+        else
+        {
+            Contention::onFail(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, __builtin_return_address(0));
+        }
+        #endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+    }
+    return res;
+}
+
+template <class A>
+bool_t Semaphore<A>::acquire(int32_t const permits, int64_t const timeout)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits == 1) )
+    {
+        res = acquire(timeout);
+    }
+    else if( isConstructed() && (permits > 1) && (handle_ == &sem_) )
+    {
+        int64_t const deadline( (timeout >= 0) ? (Clock::getTime() + timeout) : Clock::TIMEOUT_INFINITE );
+        if( batch_.lock(timeout) )
+        {
+            int32_t taken( 0 );
+            res = true;
+            while( res && (taken < permits) )
+            {
+                int64_t left( Clock::TIMEOUT_INFINITE );
+                if( deadline >= 0 )
+                {
+                    int64_t const now( Clock::getTime() );
+                    left = (deadline > now) ? (deadline - now) : 0;
+                }
+                res = acquire(left);
+                if( res )
+                {
+                    taken++;
+                }
+            }
+            if( !res && (taken > 0) )
+            {
+                static_cast<void>( release(taken) );
+            }
+            static_cast<void>( batch_.unlock() );
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t Semaphore<A>::tryAcquire(int32_t const permits)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits == 1) )
+    {
+        res = ::sem_trywait(handle_) == 0;
+    }
+    else if( isConstructed() && (permits > 1) && (handle_ == &sem_) && batch_.tryLock() )
+    {
+        // Serialized with other acquisitions of a number, which do not roll back permits taken meanwhile
+        int32_t taken( 0 );
+        while( (taken < permits) && (::sem_trywait(handle_) == 0) )
+        {
+            taken++;
+        }
+        res = taken == permits;
+        if( !res && (taken > 0) )
+        {
+            static_cast<void>( release(taken) );
+        }
+        static_cast<void>( batch_.unlock() );
+    }
+    return res;
+}
+
+template <class A>
+bool_t Semaphore<A>::release(int32_t const permits)
+{
+    bool_t res( false );
+    if( isConstructed() && (permits > 0) )
+    {
+        res = true;
+        for(int32_t i(0); (i < permits) && res; i++)
+        {
+            res = ::sem_post(handle_) == 0;
         }
     }
     return res;
@@ -147,7 +501,7 @@ bool_t Semaphore<A>::release()
     bool_t res( false );
     if( isConstructed() )
     {
-        int_t const error( ::sem_post(&sem_) );
+        int_t const error( ::sem_post(handle_) );
         if( error == 0 )
         {
             res = true; 
@@ -174,14 +528,70 @@ bool_t Semaphore<A>::construct()
 template <class A>
 bool_t Semaphore<A>::initialize()
 {
-    int_t const error( ::sem_init(&sem_, 0, static_cast<uint_t >(permits_)) );
+    int_t error( -1 );
+    if( handle_ != NULLPTR )
+    {
+        int_t const pshared( (handle_ != &sem_) ? 1 : 0 );
+        error = ::sem_init(handle_, pshared, static_cast<uint_t >(permits_));
+    }
     return error == 0;
 }
 
+template <class A>
+int_t Semaphore<A>::waitTimed(int64_t const timeout)
+{
+    int_t error( 0 );
+    #if defined (__GLIBC__) && ( (__GLIBC__ > 2) || (__GLIBC_MINOR__ >= 30) )
+    ::timespec const deadline( Clock::getDeadline(timeout) );
+    do
+    {
+        error = ::sem_clockwait(handle_, CLOCK_MONOTONIC, &deadline);
+    }
+    while( (error != 0) && (errno == EINTR) );
+    #else
+    ::timespec const realtime( Clock::getDeadline(timeout, CLOCK_REALTIME) );
+    do
+    {
+        error = ::sem_timedwait(handle_, &realtime);
+    }
+    while( (error != 0) && (errno == EINTR) );
+    #endif
+    return error;
+}
+
 template <class A>
 void Semaphore<A>::deinitialize()
 {
-    static_cast<void>( ::sem_destroy(&sem_) );
+    if( isNamed_ && (handle_ != NULLPTR) )
+    {
+        static_cast<void>( ::sem_close(handle_) );
+    }
+    else if( isOwner_ && (handle_ != NULLPTR) )
+    {
+        static_cast<void>( ::sem_destroy(handle_) );
+    }
+}
+
+template <class A>
+::sem_t* Semaphore<A>::open(char_t const* const name, int_t const flags, int32_t const permits)
+{
+    ::sem_t* sem( NULLPTR );
+    if( (name != NULLPTR) && (permits >= 0) )
+    {
+        sem = ::sem_open(name, flags, static_cast< ::mode_t >(S_IRUSR | S_IWUSR), static_cast<uint_t>(permits));
+        if( sem == SEM_FAILED )
+        {
+            sem = NULLPTR;
+        }
+    }
+    return sem;
+}
+
+template <class A>
+void Semaphore<A>::onAcquire(int64_t const start, bool_t const isContended, void const* const site) const
+{
+    int64_t const wait( isContended ? (Clock::getTime() - start) : 0 );
+    Contention::onAcquire(static_cast<api::Semaphore const*>(this), Contention::KIND_SEMAPHORE, wait, isContended, site);
 }
 
 
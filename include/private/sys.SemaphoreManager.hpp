@@ -9,8 +9,11 @@
 #include "sys.NonCopyable.hpp"
 #include "api.SemaphoreManager.hpp"
 #include "sys.Semaphore.hpp"
-#include "sys.Mutex.hpp"
-#include "lib.MemoryPool.hpp"
+#include "sys.FutexSemaphore.hpp"
+#include "sys.FairSemaphore.hpp"
+#include "sys.EventSemaphore.hpp"
+#include "sys.Contention.hpp"
+#include "sys.LockFreePool.hpp"
 
 namespace eoos
 {
@@ -24,10 +27,61 @@ namespace sys
 class SemaphoreManager : public NonCopyable<NoAllocator>, public api::SemaphoreManager
 {
     typedef NonCopyable<NoAllocator> Parent;
-    typedef Semaphore<SemaphoreManager> Resource;
+
+    /**
+     * @union Resource
+     * @brief Memory of a semaphore resource of any kind.
+     */
+    union Resource
+    {
+        /**
+         * @brief POSIX semaphore memory.
+         */
+        uint8_t posix[sizeof(Semaphore<SemaphoreManager>)];
+
+        /**
+         * @brief Futex semaphore memory.
+         */
+        uint8_t futex[sizeof(FutexSemaphore<SemaphoreManager>)];
+
+        /**
+         * @brief Fair semaphore memory.
+         */
+        uint8_t fair[sizeof(FairSemaphore<SemaphoreManager>)];
+
+        /**
+         * @brief Pollable semaphore memory.
+         */
+        uint8_t event[sizeof(EventSemaphore<SemaphoreManager>)];
+
+        /**
+         * @brief Alignment of the semaphores.
+         */
+        int64_t alignment;
+    };
 
 public:
 
+    /**
+     * @brief Size of storage for a semaphore resource.
+     */
+    static const size_t STORAGE_SIZE = sizeof(Resource);
+
+    /**
+     * @brief Alignment of storage for a semaphore resource.
+     */
+    static const size_t STORAGE_ALIGNMENT = __alignof__(Resource);
+
+    /**
+     * @brief Size of shared memory for a semaphore shared between processes.
+     */
+    static const size_t SHARED_SIZE = sizeof(::sem_t);
+
+    /**
+     * @brief Alignment of shared memory for a semaphore shared between processes.
+     */
+    static const size_t SHARED_ALIGNMENT = __alignof__(::sem_t);
+
     /**
      * @brief Constructor.
      */
@@ -46,7 +100,126 @@ public:
     /**
      * @copydoc eoos::api::SemaphoreManager::create()
      */
-    virtual api::Semaphore* create(int32_t permits);
+    virtual CountingSemaphore* create(int32_t permits);
+
+    /**
+     * @brief Creates a new semaphore resource which is fair if requested.
+     *
+     * A fair semaphore grants permits to waiting threads in order of their arrival.
+     *
+     * @param permits The initial number of permits available.
+     * @param isFair  True to create a fair semaphore.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    CountingSemaphore* create(int32_t permits, bool_t isFair);
+
+    /**
+     * @brief Creates a new semaphore resource in caller storage.
+     *
+     * @note The resource shall be destroyed by the destroy() function, and not deleted.
+     *
+     * @param storage Storage of STORAGE_SIZE bytes aligned to STORAGE_ALIGNMENT.
+     * @param permits The initial number of permits available.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    CountingSemaphore* create(void* storage, int32_t permits);
+
+    /**
+     * @brief Creates a new semaphore resource which is fair if requested in caller storage.
+     *
+     * @note The resource shall be destroyed by the destroy() function, and not deleted.
+     *
+     * @param storage Storage of STORAGE_SIZE bytes aligned to STORAGE_ALIGNMENT.
+     * @param permits The initial number of permits available.
+     * @param isFair  True to create a fair semaphore.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    CountingSemaphore* create(void* storage, int32_t permits, bool_t isFair);
+
+    /**
+     * @brief Creates a new semaphore resource with a pollable file descriptor.
+     *
+     * The descriptor of the semaphore is readable while permits are available, thus one thread
+     * waits for a number of semaphores and other descriptors by poll, select or epoll.
+     *
+     * @param permits The initial number of permits available.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    EventSemaphore<SemaphoreManager>* createPollable(int32_t permits);
+
+    /**
+     * @brief Destroys a semaphore resource created in caller storage.
+     *
+     * @param semaphore The semaphore resource, or NULLPTR.
+     */
+    void destroy(api::Semaphore* semaphore);
+
+    /**
+     * @brief Creates a new semaphore in memory shared between processes.
+     *
+     * Other processes open the semaphore by the openShared() function.
+     *
+     * @note The resource returned is local to the process and shall be deleted after the semaphore is not used
+     *       by other processes, as the deletion destroys the semaphore in the shared memory.
+     *
+     * @param memory  Shared memory of SHARED_SIZE bytes aligned to SHARED_ALIGNMENT.
+     * @param permits The initial number of permits available.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    CountingSemaphore* createShared(void* memory, int32_t permits);
+
+    /**
+     * @brief Opens a semaphore created in memory shared between processes by another process.
+     *
+     * @note The resource returned is local to the process, and its deletion does not destroy the semaphore.
+     *
+     * @param memory Shared memory of the semaphore mapped to the process.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    CountingSemaphore* openShared(void* memory);
+
+    /**
+     * @brief Creates a new named semaphore shared between processes.
+     *
+     * Other processes open the semaphore by the openNamed() function. The semaphore exists until
+     * its name is unlinked by the unlinkNamed() function and all the processes have deleted its resources.
+     *
+     * @param name    The name of the semaphore, which is a slash followed by characters not slashes.
+     * @param permits The initial number of permits available.
+     * @return A new semaphore resource, or NULLPTR if a semaphore of the name exists or an error has been occurred.
+     */
+    CountingSemaphore* createNamed(char_t const* name, int32_t permits);
+
+    /**
+     * @brief Opens a named semaphore created by another process.
+     *
+     * @param name The name of the semaphore.
+     * @return A new semaphore resource, or NULLPTR if the semaphore does not exist or an error has been occurred.
+     */
+    CountingSemaphore* openNamed(char_t const* name);
+
+    /**
+     * @brief Unlinks the name of a named semaphore.
+     *
+     * @note The semaphore is still used by resources opened, and a semaphore created after the call
+     *       with the name is another semaphore.
+     *
+     * @param name The name of the semaphore.
+     * @return True if the name has been unlinked.
+     */
+    bool_t unlinkNamed(char_t const* name);
+
+    /**
+     * @brief Returns contention reports of the most waited semaphores.
+     *
+     * @note The semaphores record contention if EOOS_GLOBAL_SYS_CONTENTION_PROFILE is defined.
+     *       The reports have no hold times, as permits may be released by other threads.
+     *
+     * @param reports Array for the reports ordered by total wait time descending.
+     * @param number  Size of the array.
+     * @return Number of the reports.
+     */
+    int32_t getReports(Contention::Report* reports, int32_t number) const;
 
     /**
      * @brief Allocates memory.
@@ -89,6 +262,27 @@ private:
      */
     static void deinitialize();
 
+    /**
+     * @brief Creates a new semaphore resource.
+     *
+     * @param permits The initial number of permits available.
+     * @param isFair  True to create a fair semaphore.
+     * @param storage Caller storage, or NULLPTR to allocate the resource.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    static CountingSemaphore* createResource(int32_t permits, bool_t isFair, void* storage);
+
+    /**
+     * @brief Creates a new semaphore resource of a class.
+     *
+     * @tparam R The semaphore class.
+     * @param permits The initial number of permits available.
+     * @param storage Caller storage, or NULLPTR to allocate the resource.
+     * @return A new semaphore resource, or NULLPTR if an error has been occurred.
+     */
+    template <class R>
+    static CountingSemaphore* newResource(int32_t permits, void* storage);
+
     /**
      * @struct ResourcePool
      * @brief Resource memory pool.
@@ -103,19 +297,10 @@ private:
          */
         ResourcePool();
 
-    private:
-
-        /**
-         * @brief Mutex resource.
-         */
-        Mutex<NoAllocator> mutex_;
-
-    public:
-
         /**
          * @brief Semaphore memory allocator.
          */
-        lib::MemoryPool<Resource,EOOS_GLOBAL_SYS_SEMAPHORE_AMOUNT> memory;
+        LockFreePool<Resource,EOOS_GLOBAL_SYS_SEMAPHORE_AMOUNT> memory;
 
     };
 
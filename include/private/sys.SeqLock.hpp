@@ -0,0 +1,220 @@
+/**
+ * @file      sys.SeqLock.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SEQLOCK_HPP_
+#define SYS_SEQLOCK_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Atomic.hpp"
+#include "sys.Backoff.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class SeqLock
+ * @brief Sequence lock of a value for read-mostly data.
+ *
+ * A writer makes the sequence odd, stores the value, and makes the sequence even again.
+ * A reader loads the sequence and the value, and retries if the sequence has been odd or
+ * has changed meanwhile, thus readers do not write any shared memory and never block writers.
+ * The value is copied in machine words by relaxed atomic operations, which makes reading
+ * a value being written well-defined.
+ *
+ * @note Writers exclude each other by spinning, thus they are expected to be rare and short.
+ *
+ * @tparam T Trivially copyable type of the value.
+ * @tparam A Heap memory allocator class.
+ */
+template <typename T, class A = NoAllocator>
+class SeqLock : public NonCopyable<A>
+{
+    typedef NonCopyable<A> Parent;
+
+    /**
+     * @brief Fails compilation for a type of the value which is not trivially copyable.
+     */
+    typedef char TriviallyCopyable[ __is_trivially_copyable(T) ? 1 : -1 ];
+
+public:
+
+    /**
+     * @brief Constructor of a zero value.
+     */
+    SeqLock();
+
+    /**
+     * @brief Constructor.
+     *
+     * @param value The initial value.
+     */
+    explicit SeqLock(T const& value);
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~SeqLock();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Reads the value once.
+     *
+     * @param value The value read.
+     * @return True if the value has been read, false if a writer has interfered.
+     */
+    bool_t tryRead(T& value) const;
+
+    /**
+     * @brief Reads the value retrying while writers interfere.
+     *
+     * @param value The value read.
+     * @return True if the value has been read.
+     */
+    bool_t read(T& value) const;
+
+    /**
+     * @brief Writes the value.
+     *
+     * @param value The value to write.
+     * @return True if the value has been written.
+     */
+    bool_t write(T const& value);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Number of machine words of the value.
+     */
+    static const size_t WORDS = (sizeof(T) + sizeof(size_t) - 1U) / sizeof(size_t);
+
+    /**
+     * @brief Stores the value to the words.
+     *
+     * @param value The value.
+     */
+    void store(T const& value);
+
+    /**
+     * @brief The sequence, which is odd while the value is being written.
+     */
+    Atomic<uint32_t> seq_;
+
+    /**
+     * @brief The value.
+     */
+    size_t words_[WORDS];
+
+};
+
+template <typename T, class A>
+SeqLock<T,A>::SeqLock()
+    : NonCopyable<A>()
+    , seq_( 0U )
+    , words_() {
+}
+
+template <typename T, class A>
+SeqLock<T,A>::SeqLock(T const& value)
+    : NonCopyable<A>()
+    , seq_( 0U )
+    , words_() {
+    store(value);
+}
+
+template <typename T, class A>
+SeqLock<T,A>::~SeqLock()
+{
+}
+
+template <typename T, class A>
+bool_t SeqLock<T,A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <typename T, class A>
+bool_t SeqLock<T,A>::tryRead(T& value) const
+{
+    bool_t res( false );
+    uint32_t const seq( seq_.load(Atomic<uint32_t>::ORDER_ACQUIRE) );
+    if( isConstructed() && ( (seq & 1U) == 0U ) )
+    {
+        size_t words[WORDS];
+        for(size_t i(0U); i < WORDS; i++)
+        {
+            words[i] = __atomic_load_n(&words_[i], __ATOMIC_RELAXED);
+        }
+        // Order the value loads before the sequence reload
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if( seq_.load(Atomic<uint32_t>::ORDER_RELAXED) == seq )
+        {
+            __builtin_memcpy(&value, words, sizeof(T));
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <typename T, class A>
+bool_t SeqLock<T,A>::read(T& value) const
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        while( !tryRead(value) )
+        {
+            Backoff::relax();
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <typename T, class A>
+bool_t SeqLock<T,A>::write(T const& value)
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        Backoff backoff;
+        uint32_t seq( seq_.load(Atomic<uint32_t>::ORDER_RELAXED) );
+        while( ( (seq & 1U) != 0U ) || !seq_.compareExchange(seq, seq + 1U, Atomic<uint32_t>::ORDER_ACQUIRE) )
+        {
+            backoff.pause();
+            seq = seq_.load(Atomic<uint32_t>::ORDER_RELAXED);
+        }
+        // Order the odd sequence before the value stores
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        store(value);
+        seq_.store(seq + 2U, Atomic<uint32_t>::ORDER_RELEASE);
+        res = true;
+    }
+    return res;
+}
+
+template <typename T, class A>
+void SeqLock<T,A>::store(T const& value)
+{
+    size_t words[WORDS] = { 0U };
+    __builtin_memcpy(words, &value, sizeof(T));
+    for(size_t i(0U); i < WORDS; i++)
+    {
+        __atomic_store_n(&words_[i], words[i], __ATOMIC_RELAXED);
+    }
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SEQLOCK_HPP_
@@ -0,0 +1,152 @@
+/**
+ * @file      sys.Spinlock.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SPINLOCK_HPP_
+#define SYS_SPINLOCK_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Mutex.hpp"
+#include "sys.Atomic.hpp"
+#include "sys.Backoff.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Spinlock.
+ * @brief Spinlock class for very short critical sections.
+ *
+ * The lock tests the lock word by plain loads until it looks free, and only then tries
+ * to set it, thus waiting threads do not write the cache line of the word. Failed tries
+ * are backed off exponentially, and a thread which has backed off to the limit yields
+ * the CPU, as the owner may be preempted.
+ *
+ * @note The lock does not sleep in the kernel and does not check errors.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class Spinlock : public NonCopyable<A>, public api::Mutex
+{
+    typedef NonCopyable<A> Parent;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Spinlock();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Spinlock();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @copydoc eoos::api::Mutex::tryLock()
+     */
+    virtual bool_t tryLock();
+
+    /**
+     * @copydoc eoos::api::Mutex::lock()
+     */
+    virtual bool_t lock();
+
+    /**
+     * @copydoc eoos::api::Mutex::unlock()
+     */
+    virtual bool_t unlock();
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief The lock word, which is not zero if the lock is locked.
+     */
+    Atomic<int32_t> word_;
+
+};
+
+template <class A>
+Spinlock<A>::Spinlock()
+    : NonCopyable<A>()
+    , api::Mutex()
+    , word_( 0 ) {
+}
+
+template <class A>
+Spinlock<A>::~Spinlock()
+{
+}
+
+template <class A>
+bool_t Spinlock<A>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t Spinlock<A>::tryLock()
+{
+    bool_t res( false );
+    if( isConstructed() && (word_.load(Atomic<int32_t>::ORDER_RELAXED) == 0) )
+    {
+        res = word_.exchange(1, Atomic<int32_t>::ORDER_ACQUIRE) == 0;
+    }
+    return res;
+}
+
+template <class A>
+bool_t Spinlock<A>::lock()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        Backoff backoff;
+        while( word_.exchange(1, Atomic<int32_t>::ORDER_ACQUIRE) != 0 )
+        {
+            do
+            {
+                if( !backoff.isSaturated() )
+                {
+                    backoff.pause();
+                }
+                else
+                {
+                    static_cast<void>( ::sched_yield() );
+                }
+            }
+            while( word_.load(Atomic<int32_t>::ORDER_RELAXED) != 0 );
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <class A>
+bool_t Spinlock<A>::unlock()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        word_.store(0, Atomic<int32_t>::ORDER_RELEASE);
+        res = true;
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SPINLOCK_HPP_
@@ -12,7 +12,11 @@
 #include "sys.Scheduler.hpp"
 #include "sys.MutexManager.hpp"
 #include "sys.SemaphoreManager.hpp"
+#include "sys.RwLockManager.hpp"
+#include "sys.ConditionVariableManager.hpp"
+#include "sys.EventManager.hpp"
 #include "sys.StreamManager.hpp"
+#include "sys.Futex.hpp"
 
 namespace eoos
 {
@@ -47,18 +51,74 @@ public:
     /**
      * @copydoc eoos::api::System::getMutexManager()
      */
-    virtual api::MutexManager& getMutexManager();
+    virtual MutexManager& getMutexManager();
 
     /**
      * @copydoc eoos::api::System::getSemaphoreManager()
      */
-    virtual api::SemaphoreManager& getSemaphoreManager();
+    virtual SemaphoreManager& getSemaphoreManager();
 
     /**
      * @copydoc eoos::api::System::getStreamManager()
      */
     virtual api::StreamManager& getStreamManager();
 
+    /**
+     * @brief Returns the system reader-writer lock manager.
+     *
+     * @return The system reader-writer lock manager.
+     */
+    RwLockManager& getRwLockManager();
+
+    /**
+     * @brief Returns the system condition variable manager.
+     *
+     * @return The system condition variable manager.
+     */
+    ConditionVariableManager& getConditionVariableManager();
+
+    /**
+     * @brief Returns the system event manager.
+     *
+     * @return The system event manager.
+     */
+    EventManager& getEventManager();
+
+    /**
+     * @brief Waits until a word is woken up if the word holds an expected value.
+     *
+     * The word is a futex private to the process, thus lock-free structures block on their own words
+     * and a thread changing a word wakes up the threads waiting on it by the wakeAddress() function.
+     *
+     * @param addr     The word address.
+     * @param expected The expected value.
+     * @param timeout  Relative timeout in nanoseconds, or Futex::TIMEOUT_INFINITE.
+     * @return False if the timeout has expired or an error occurred, otherwise true
+     *         even if the word does not hold the expected value or the wait is spurious.
+     */
+    bool_t waitOnAddress(int32_t* addr, int32_t expected, int64_t timeout = Futex::TIMEOUT_INFINITE);
+
+    /**
+     * @brief Waits until one of words is woken up if all the words hold their expected values.
+     *
+     * @param addrs    Array of the word addresses.
+     * @param expected Array of the expected values.
+     * @param number   Number of the words not more than Futex::WAIT_ANY_MAX.
+     * @param timeout  Relative timeout in nanoseconds, or Futex::TIMEOUT_INFINITE.
+     * @return Index of a word woken up or not holding its expected value,
+     *         or -1 if the timeout has expired or an error occurred.
+     */
+    int32_t waitOnAddresses(int32_t* const* addrs, int32_t const* expected, int32_t number, int64_t timeout = Futex::TIMEOUT_INFINITE);
+
+    /**
+     * @brief Wakes up threads waiting on a word.
+     *
+     * @param addr   The word address.
+     * @param number Maximum number of threads to wake up.
+     * @return Number of threads woken up.
+     */
+    int32_t wakeAddress(int32_t* addr, int32_t number);
+
     /**
      * @brief Runs the EOOS system.
      *
@@ -93,6 +153,41 @@ private:
      */
     bool_t construct();
 
+    /**
+     * @brief Sets memory of the process resident in RAM.
+     *
+     * @return True if the memory policy is set.
+     */
+    static bool_t setMemoryPolicy();
+
+    /**
+     * @brief Touches pages of heap memory.
+     *
+     * @param size Number of bytes to touch.
+     * @return True if the memory is touched.
+     */
+    static bool_t prefaultHeap(size_t size);
+
+    /**
+     * @brief Touches pages of the calling thread stack.
+     *
+     * @note The function shall not be inlined to free its stack frame on return.
+     */
+    static void prefaultStack() __attribute__((noinline));
+
+    /**
+     * @brief Returns number of bytes of the calling thread stack which may be touched.
+     *
+     * @param size Number of bytes requested.
+     * @return Number of bytes requested, which is limited by the stack free below the caller less a margin.
+     */
+    static size_t getStackPrefault(size_t size);
+
+    /**
+     * @brief Number of bytes of the stack left untouched for frames of later calls and signal handlers.
+     */
+    static const size_t STACK_MARGIN = 0x10000U;
+
     /**
      * @brief The operating system.
      */
@@ -113,6 +208,21 @@ private:
      */
     MutexManager mutexManager_;
 
+    /**
+     * @brief The reader-writer lock sub-system manager.
+     */
+    RwLockManager rwLockManager_;
+
+    /**
+     * @brief The condition variable sub-system manager.
+     */
+    ConditionVariableManager conditionVariableManager_;
+
+    /**
+     * @brief The event sub-system manager.
+     */
+    EventManager eventManager_;
+
     /**
      * @brief The semaphore sub-system manager.
      */
@@ -0,0 +1,672 @@
+/**
+ * @file      sys.TaskGraph.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TASKGRAPH_HPP_
+#define SYS_TASKGRAPH_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Atomic.hpp"
+#include "sys.Mutex.hpp"
+#include "sys.Semaphore.hpp"
+#include "api.Scheduler.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class TaskGraph
+ * @brief Executor of tasks ordered by a directed acyclic dependency graph.
+ *
+ * Each node counts its predecessors not executed yet, and the node is released to a ready queue
+ * when the counter hits zero. Each thread has its own ready queue. A thread executes the node
+ * released last to its queue first, so a successor is executed on the thread executed its
+ * predecessor while the predecessor data is hot in the CPU cache. Idle threads steal the oldest
+ * nodes from queues of other threads. A node locality hint makes the node be released to the
+ * queue of the given thread.
+ *
+ * @tparam N Maximum number of nodes.
+ * @tparam S Maximum number of successors of one node.
+ */
+template <int32_t N, int32_t S = 8>
+class TaskGraph : public NonCopyable<NoAllocator>
+{
+    typedef NonCopyable<NoAllocator> Parent;
+
+public:
+
+    /**
+     * @brief Wrong node index.
+     */
+    static const int32_t NODE_WRONG = -1;
+
+    /**
+     * @brief Constructor.
+     */
+    TaskGraph();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~TaskGraph();
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    virtual bool_t isConstructed() const;
+
+    /**
+     * @brief Adds a task node to the graph.
+     *
+     * @param task The task to execute.
+     * @return Index of the node, or NODE_WRONG if the graph is full.
+     */
+    int32_t addTask(api::Task& task);
+
+    /**
+     * @brief Declares a node predecessor.
+     *
+     * @param node        Index of the node.
+     * @param predecessor Index of the node which shall be executed before.
+     * @return True if the predecessor has been declared.
+     */
+    bool_t addPredecessor(int32_t node, int32_t predecessor);
+
+    /**
+     * @brief Sets a node locality hint.
+     *
+     * @param node   Index of the node.
+     * @param thread Index of the thread to execute the node, where zero is the calling thread
+     *               of the execute function, or NODE_WRONG to execute the node on any thread.
+     * @return True if the hint has been set.
+     */
+    bool_t setLocality(int32_t node, int32_t thread);
+
+    /**
+     * @brief Executes the graph.
+     *
+     * @param scheduler The scheduler to create worker threads.
+     * @param threads   Number of threads to execute the graph including the calling thread.
+     * @return True if all the nodes have been executed, or false if the graph has a cycle.
+     */
+    bool_t execute(api::Scheduler& scheduler, int32_t threads);
+
+protected:
+
+    using Parent::setConstructed;
+
+private:
+
+    /**
+     * @brief Maximum number of threads executing the graph.
+     */
+    static const int32_t THREADS_MAX = EOOS_GLOBAL_SYS_PARALLEL_THREADS;
+
+    /**
+     * @struct Node
+     * @brief Graph node.
+     */
+    struct Node
+    {
+        /**
+         * @brief Constructor.
+         */
+        Node();
+
+        /**
+         * @brief The task to execute.
+         */
+        api::Task* task;
+
+        /**
+         * @brief Successor node indices.
+         */
+        int32_t successors[S];
+
+        /**
+         * @brief Number of successors.
+         */
+        int32_t successorsNumber;
+
+        /**
+         * @brief Number of predecessors.
+         */
+        int32_t predecessorsNumber;
+
+        /**
+         * @brief Index of the thread to execute the node, or NODE_WRONG.
+         */
+        int32_t locality;
+
+        /**
+         * @brief Number of predecessors not executed yet.
+         */
+        Atomic<int32_t> counter;
+
+        /**
+         * @brief Previous node in a ready queue.
+         */
+        int32_t prev;
+
+        /**
+         * @brief Next node in a ready queue.
+         */
+        int32_t next;
+    };
+
+    /**
+     * @struct Queue
+     * @brief Ready queue of a thread.
+     */
+    struct Queue
+    {
+        /**
+         * @brief Constructor.
+         */
+        Queue();
+
+        /**
+         * @brief The queue guard.
+         */
+        Mutex<NoAllocator> mutex;
+
+        /**
+         * @brief The oldest node index.
+         */
+        int32_t head;
+
+        /**
+         * @brief The newest node index.
+         */
+        int32_t tail;
+    };
+
+    /**
+     * @class Worker
+     * @brief Task of a worker thread.
+     */
+    class Worker : public NonCopyable<NoAllocator>, public api::Task
+    {
+        typedef NonCopyable<NoAllocator> Parent;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         */
+        Worker();
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~Worker();
+
+        /**
+         * @copydoc eoos::api::Object::isConstructed()
+         */
+        virtual bool_t isConstructed() const;
+
+        /**
+         * @copydoc eoos::api::Task::start()
+         */
+        virtual void start();
+
+        /**
+         * @copydoc eoos::api::Task::getStackSize()
+         */
+        virtual size_t getStackSize() const;
+
+        /**
+         * @brief Binds the worker to a graph.
+         *
+         * @param graph The graph to execute.
+         * @param index The thread index.
+         */
+        void bind(TaskGraph* graph, int32_t index);
+
+    private:
+
+        /**
+         * @brief The graph to execute.
+         */
+        TaskGraph* graph_;
+
+        /**
+         * @brief The thread index.
+         */
+        int32_t index_;
+
+    };
+
+    /**
+     * @brief Constructs this object.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct();
+
+    /**
+     * @brief Tests if the graph has no cycles.
+     *
+     * @return True if the graph is acyclic.
+     */
+    bool_t isAcyclic();
+
+    /**
+     * @brief Executes nodes until the graph is executed.
+     *
+     * @param index The thread index.
+     */
+    void work(int32_t index);
+
+    /**
+     * @brief Releases a node to a ready queue.
+     *
+     * @param node  Index of the node.
+     * @param index Index of the thread releasing the node.
+     */
+    void release(int32_t node, int32_t index);
+
+    /**
+     * @brief Takes a node from the ready queues.
+     *
+     * @param index The thread index.
+     * @return Index of the node, or NODE_WRONG if all the queues are empty.
+     */
+    int32_t take(int32_t index);
+
+    /**
+     * @brief Tests if a node index is valid.
+     *
+     * @param node Index of the node.
+     * @return True if the index is valid.
+     */
+    bool_t isNode(int32_t node) const;
+
+    /**
+     * @brief The graph nodes.
+     */
+    Node nodes_[N];
+
+    /**
+     * @brief Number of nodes.
+     */
+    int32_t nodesNumber_;
+
+    /**
+     * @brief Ready queues of the threads.
+     */
+    Queue queues_[THREADS_MAX];
+
+    /**
+     * @brief Number of threads executing the graph.
+     */
+    int32_t threads_;
+
+    /**
+     * @brief Number of nodes not executed yet.
+     */
+    Atomic<int32_t> remaining_;
+
+    /**
+     * @brief Number of nodes in the ready queues.
+     */
+    Semaphore<NoAllocator> ready_;
+
+    /**
+     * @brief Worker tasks.
+     */
+    Worker workers_[THREADS_MAX];
+
+};
+
+template <int32_t N, int32_t S>
+TaskGraph<N,S>::TaskGraph()
+    : NonCopyable<NoAllocator>()
+    , nodes_()
+    , nodesNumber_( 0 )
+    , queues_()
+    , threads_( 0 )
+    , remaining_( 0 )
+    , ready_( 0 )
+    , workers_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <int32_t N, int32_t S>
+TaskGraph<N,S>::~TaskGraph()
+{
+}
+
+template <int32_t N, int32_t S>
+bool_t TaskGraph<N,S>::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <int32_t N, int32_t S>
+int32_t TaskGraph<N,S>::addTask(api::Task& task)
+{
+    int32_t node( NODE_WRONG );
+    if( isConstructed() && (nodesNumber_ < N) )
+    {
+        node = nodesNumber_;
+        nodes_[node].task = &task;
+        nodesNumber_++;
+    }
+    return node;
+}
+
+template <int32_t N, int32_t S>
+bool_t TaskGraph<N,S>::addPredecessor(int32_t node, int32_t predecessor)
+{
+    bool_t res( false );
+    if( isConstructed() && isNode(node) && isNode(predecessor) && (node != predecessor) )
+    {
+        Node& pred( nodes_[predecessor] );
+        if( pred.successorsNumber < S )
+        {
+            pred.successors[pred.successorsNumber] = node;
+            pred.successorsNumber++;
+            nodes_[node].predecessorsNumber++;
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <int32_t N, int32_t S>
+bool_t TaskGraph<N,S>::setLocality(int32_t node, int32_t thread)
+{
+    bool_t res( false );
+    if( isConstructed() && isNode(node) && (thread >= NODE_WRONG) && (thread < THREADS_MAX) )
+    {
+        nodes_[node].locality = thread;
+        res = true;
+    }
+    return res;
+}
+
+template <int32_t N, int32_t S>
+bool_t TaskGraph<N,S>::execute(api::Scheduler& scheduler, int32_t threads)
+{
+    bool_t res( false );
+    if( isConstructed() && isAcyclic() )
+    {
+        api::Thread* workers[THREADS_MAX];
+        int32_t created( 0 );
+        int32_t const number( (threads < THREADS_MAX) ? threads : THREADS_MAX );
+        // Workers wait on the ready semaphore until the roots are released
+        for(int32_t i(1); i < number; i++)
+        {
+            workers_[i].bind(this, i);
+            api::Thread* const thread( scheduler.createThread(workers_[i]) );
+            if( thread == NULLPTR )
+            {
+                break;
+            }
+            if( !thread->execute() )
+            {
+                delete thread;
+                break;
+            }
+            workers[created] = thread;
+            created++;
+        }
+        threads_ = created + 1;
+        remaining_.store(nodesNumber_);
+        for(int32_t i(0); i < nodesNumber_; i++)
+        {
+            nodes_[i].counter.store(nodes_[i].predecessorsNumber, Atomic<int32_t>::ORDER_RELAXED);
+        }
+        if( nodesNumber_ == 0 )
+        {
+            // Let the workers exit
+            for(int32_t i(0); i < threads_; i++)
+            {
+                static_cast<void>( ready_.release() );
+            }
+        }
+        for(int32_t i(0); i < nodesNumber_; i++)
+        {
+            if( nodes_[i].predecessorsNumber == 0 )
+            {
+                // Spread the roots over the threads
+                release(i, i % threads_);
+            }
+        }
+        work(0);
+        for(int32_t i(0); i < created; i++)
+        {
+            static_cast<void>( workers[i]->join() );
+            delete workers[i];
+        }
+        res = true;
+    }
+    return res;
+}
+
+template <int32_t N, int32_t S>
+bool_t TaskGraph<N,S>::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        res = ready_.isConstructed();
+        for(int32_t i(0); i < THREADS_MAX; i++)
+        {
+            if( !queues_[i].mutex.isConstructed() )
+            {
+                res = false;
+            }
+        }
+    }
+    return res;
+}
+
+template <int32_t N, int32_t S>
+bool_t TaskGraph<N,S>::isAcyclic()
+{
+    // Kahn's algorithm on the node counters with the node next indices as a stack
+    int32_t stack( NODE_WRONG );
+    for(int32_t i(0); i < nodesNumber_; i++)
+    {
+        nodes_[i].counter.store(nodes_[i].predecessorsNumber, Atomic<int32_t>::ORDER_RELAXED);
+        if( nodes_[i].predecessorsNumber == 0 )
+        {
+            nodes_[i].next = stack;
+            stack = i;
+        }
+    }
+    int32_t visited( 0 );
+    while( stack != NODE_WRONG )
+    {
+        Node& node( nodes_[stack] );
+        stack = node.next;
+        visited++;
+        for(int32_t i(0); i < node.successorsNumber; i++)
+        {
+            int32_t const succ( node.successors[i] );
+            if( nodes_[succ].counter.fetchSub(1, Atomic<int32_t>::ORDER_RELAXED) == 1 )
+            {
+                nodes_[succ].next = stack;
+                stack = succ;
+            }
+        }
+    }
+    return visited == nodesNumber_;
+}
+
+template <int32_t N, int32_t S>
+void TaskGraph<N,S>::work(int32_t index)
+{
+    while( ready_.acquire() )
+    {
+        if( remaining_.load() == 0 )
+        {
+            break;
+        }
+        int32_t node( take(index) );
+        while( node == NODE_WRONG )
+        {
+            // The acquired node is being released to a queue already scanned
+            node = take(index);
+        }
+        nodes_[node].task->start();
+        for(int32_t i(0); i < nodes_[node].successorsNumber; i++)
+        {
+            int32_t const succ( nodes_[node].successors[i] );
+            if( nodes_[succ].counter.fetchSub(1, Atomic<int32_t>::ORDER_ACQ_REL) == 1 )
+            {
+                release(succ, index);
+            }
+        }
+        if( remaining_.fetchSub(1) == 1 )
+        {
+            // The last node is executed, thus let all the threads exit
+            for(int32_t i(0); i < threads_; i++)
+            {
+                static_cast<void>( ready_.release() );
+            }
+        }
+    }
+}
+
+template <int32_t N, int32_t S>
+void TaskGraph<N,S>::release(int32_t node, int32_t index)
+{
+    int32_t const locality( nodes_[node].locality );
+    Queue& queue( queues_[ (locality == NODE_WRONG) ? index : (locality % threads_) ] );
+    static_cast<void>( queue.mutex.lock() );
+    nodes_[node].next = NODE_WRONG;
+    nodes_[node].prev = queue.tail;
+    if( queue.tail == NODE_WRONG )
+    {
+        queue.head = node;
+    }
+    else
+    {
+        nodes_[queue.tail].next = node;
+    }
+    queue.tail = node;
+    static_cast<void>( queue.mutex.unlock() );
+    static_cast<void>( ready_.release() );
+}
+
+template <int32_t N, int32_t S>
+int32_t TaskGraph<N,S>::take(int32_t index)
+{
+    int32_t node( NODE_WRONG );
+    // Take the newest node of the own queue
+    Queue& own( queues_[index] );
+    static_cast<void>( own.mutex.lock() );
+    if( own.tail != NODE_WRONG )
+    {
+        node = own.tail;
+        own.tail = nodes_[node].prev;
+        if( own.tail == NODE_WRONG )
+        {
+            own.head = NODE_WRONG;
+        }
+        else
+        {
+            nodes_[own.tail].next = NODE_WRONG;
+        }
+    }
+    static_cast<void>( own.mutex.unlock() );
+    // Steal the oldest node of other queues
+    for(int32_t i(1); (i < threads_) && (node == NODE_WRONG); i++)
+    {
+        Queue& queue( queues_[ (index + i) % threads_ ] );
+        static_cast<void>( queue.mutex.lock() );
+        if( queue.head != NODE_WRONG )
+        {
+            node = queue.head;
+            queue.head = nodes_[node].next;
+            if( queue.head == NODE_WRONG )
+            {
+                queue.tail = NODE_WRONG;
+            }
+            else
+            {
+                nodes_[queue.head].prev = NODE_WRONG;
+            }
+        }
+        static_cast<void>( queue.mutex.unlock() );
+    }
+    return node;
+}
+
+template <int32_t N, int32_t S>
+bool_t TaskGraph<N,S>::isNode(int32_t node) const
+{
+    return (0 <= node) && (node < nodesNumber_);
+}
+
+template <int32_t N, int32_t S>
+TaskGraph<N,S>::Node::Node()
+    : task( NULLPTR )
+    , successors()
+    , successorsNumber( 0 )
+    , predecessorsNumber( 0 )
+    , locality( NODE_WRONG )
+    , counter( 0 )
+    , prev( NODE_WRONG )
+    , next( NODE_WRONG ) {
+}
+
+template <int32_t N, int32_t S>
+TaskGraph<N,S>::Queue::Queue()
+    : mutex()
+    , head( NODE_WRONG )
+    , tail( NODE_WRONG ) {
+}
+
+template <int32_t N, int32_t S>
+TaskGraph<N,S>::Worker::Worker()
+    : NonCopyable<NoAllocator>()
+    , api::Task()
+    , graph_( NULLPTR )
+    , index_( 0 ) {
+}
+
+template <int32_t N, int32_t S>
+TaskGraph<N,S>::Worker::~Worker()
+{
+}
+
+template <int32_t N, int32_t S>
+bool_t TaskGraph<N,S>::Worker::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+template <int32_t N, int32_t S>
+void TaskGraph<N,S>::Worker::start()
+{
+    if( graph_ != NULLPTR )
+    {
+        graph_->work(index_);
+    }
+}
+
+template <int32_t N, int32_t S>
+size_t TaskGraph<N,S>::Worker::getStackSize() const
+{
+    return 0U;
+}
+
+template <int32_t N, int32_t S>
+void TaskGraph<N,S>::Worker::bind(TaskGraph* graph, int32_t index)
+{
+    graph_ = graph;
+    index_ = index;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_TASKGRAPH_HPP_
@@ -9,6 +9,7 @@
 #include "sys.NonCopyable.hpp"
 #include "api.Thread.hpp"
 #include "api.Task.hpp"
+#include "sys.BusyPoll.hpp"
 
 namespace eoos
 {
@@ -35,6 +36,16 @@ public:
      */
     Thread(api::Task& task);
 
+    /**
+     * @brief Constructor of not constructed object of a thread dedicated to a CPU.
+     *
+     * @note The thread runs in the busy-poll mode.
+     *
+     * @param task A task interface whose main method is invoked when this thread is started.
+     * @param cpu  The CPU the thread is pinned to.
+     */
+    Thread(api::Task& task, int32_t cpu);
+
     /**
      * @brief Destructor.
      */
@@ -71,6 +82,11 @@ protected:
 
 private:
 
+    /**
+     * @brief Not dedicated CPU.
+     */
+    static const int32_t CPU_WRONG = -1;
+
     /**
      * @brief Constructor.
      *
@@ -78,6 +94,14 @@ private:
      */
     bool_t construct();
 
+    /**
+     * @brief Sets the dedicated CPU to the pthread attributes.
+     *
+     * @param attr The pthread attributes.
+     * @return Error number or zero.
+     */
+    int_t setAffinity(::pthread_attr_t& attr) const;
+
     /**
      * @brief Starts a thread routine.
      *
@@ -128,6 +152,11 @@ private:
      */
     ::pthread_t thread_;    
 
+    /**
+     * @brief The CPU the thread is dedicated to, or CPU_WRONG.
+     */
+    int32_t cpu_;
+
 };
 
 template <class A>
@@ -137,7 +166,21 @@ Thread<A>::Thread(api::Task& task)
     , task_ (&task)
     , status_ (STATUS_NEW)
     , priority_ (PRIORITY_NORM)
-    , thread_ (0) {
+    , thread_ (0)
+    , cpu_ (CPU_WRONG) {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+template <class A>
+Thread<A>::Thread(api::Task& task, int32_t cpu) 
+    : NonCopyable<A>()
+    , api::Thread()
+    , task_ (&task)
+    , status_ (STATUS_NEW)
+    , priority_ (PRIORITY_NORM)
+    , thread_ (0)
+    , cpu_ (cpu) {
     bool_t const isConstructed( construct() );
     setConstructed( isConstructed );
 }
@@ -176,7 +219,11 @@ bool_t Thread<A>::execute()
         }
         if(error == 0)
         {
-            error = ::pthread_create(&thread_, &pthreadAttr.attr, &start, &task_);
+            error = setAffinity(pthreadAttr.attr);
+        }
+        if(error == 0)
+        {
+            error = ::pthread_create(&thread_, &pthreadAttr.attr, &start, this);
             if(error == 0)
             {            
                 status_ = STATUS_RUNNABLE;
@@ -235,7 +282,7 @@ template <class A>
 bool_t Thread<A>::construct()
 {
     bool_t res( false );
-    if( isConstructed() && Parent::isConstructed(task_) )
+    if( isConstructed() && Parent::isConstructed(task_) && (cpu_ >= CPU_WRONG) && (cpu_ < CPU_SETSIZE) )
     {
         status_ = STATUS_NEW;
         res = true;
@@ -247,17 +294,33 @@ bool_t Thread<A>::construct()
     return res;    
 }
 
+template <class A>
+int_t Thread<A>::setAffinity(::pthread_attr_t& attr) const
+{
+    int_t error( 0 );
+    if( cpu_ != CPU_WRONG )
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu_, &set);
+        error = ::pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+    }
+    return error;
+}
+
 template <class A>
 void* Thread<A>::start(void* argument)
 {
     if(argument != NULLPTR) 
     {
-        api::Task** addr( reinterpret_cast<api::Task**>(argument) );
-        if( addr != NULLPTR )
+        Thread* const thread( reinterpret_cast<Thread*>(argument) ); ///< SCA MISRA-C++:2008 Justified Rule 5-2-8
+        if( thread != NULLPTR )
         {
-            api::Task* const task( *addr ); ///< SCA MISRA-C++:2008 Justified Rule 5-2-8
+            api::Task* const task( thread->task_ );
             if( Parent::isConstructed(task) )
             {
+                // A thread dedicated to a CPU does not share the CPU, thus it spins instead of sleeping
+                BusyPoll::setEnabled( thread->cpu_ != CPU_WRONG );
                 int_t oldtype;
                 // The thread is cancelable.  This is the default
                 // cancelability state in all new threads, including the
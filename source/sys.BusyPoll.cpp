@@ -0,0 +1,21 @@
+/**
+ * @file      sys.BusyPoll.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.BusyPoll.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+__thread bool_t BusyPoll::isEnabled_( false );
+
+void BusyPoll::setEnabled(bool_t enable)
+{
+    isEnabled_ = enable;
+}
+
+} // namespace sys
+} // namespace eoos
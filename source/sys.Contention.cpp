@@ -0,0 +1,364 @@
+/**
+ * @file      sys.Contention.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.Contention.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+#ifdef EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+
+Contention::Buffer Contention::buffers_[THREADS];
+
+Atomic<int32_t> Contention::count_( 0 );
+
+void const* const Contention::REMOVED( &Contention::count_ );
+
+::pthread_key_t Contention::key_;
+
+::pthread_once_t Contention::once_ = PTHREAD_ONCE_INIT;
+
+Atomic<int64_t> Contention::dropped_( 0 );
+
+__thread Contention::Buffer* Contention::buffer_( NULLPTR );
+
+void Contention::onAcquire(void const* const object, Kind const kind, int64_t const wait, bool_t const isContended, void const* const site)
+{
+    Report* const report( getReport(object, kind) );
+    if( report != NULLPTR )
+    {
+        add(report->acquisitions, 1);
+        add(report->waits[getBucket(wait)], 1);
+        add(report->waitTime, wait);
+        if( isContended )
+        {
+            add(report->contentions, 1);
+            addSite(*report, site);
+        }
+    }
+}
+
+void Contention::onFail(void const* const object, Kind const kind, void const* const site)
+{
+    Report* const report( getReport(object, kind) );
+    if( report != NULLPTR )
+    {
+        add(report->failures, 1);
+        addSite(*report, site);
+    }
+}
+
+void Contention::onRelease(void const* const object, Kind const kind, int64_t const hold)
+{
+    Report* const report( getReport(object, kind) );
+    if( report != NULLPTR )
+    {
+        add(report->holds[getBucket(hold)], 1);
+        add(report->holdTime, hold);
+    }
+}
+
+void Contention::onDestroy(void const* const object, Kind const kind)
+{
+    int32_t const count( count_.load() );
+    int32_t const buffers( (count < THREADS) ? count : THREADS );
+    for(int32_t i(0); i < buffers * RECORDS; i++)
+    {
+        Record& record( buffers_[i / RECORDS].records[i % RECORDS] );
+        if( (__atomic_load_n(&record.report.object, __ATOMIC_ACQUIRE) == object) && (record.kind == kind) )
+        {
+            // The record is not written by its thread, as the object is not used, and not taken until removed
+            clear(record.report);
+            __atomic_store_n(&record.report.object, REMOVED, __ATOMIC_RELEASE);
+        }
+    }
+}
+
+int32_t Contention::getReports(Kind const kind, Report* const reports, int32_t const number)
+{
+    int32_t size( 0 );
+    int32_t const count( count_.load() );
+    int32_t const buffers( (count < THREADS) ? count : THREADS );
+    for(int32_t i(0); i < buffers * RECORDS; i++)
+    {
+        Record const& record( buffers_[i / RECORDS].records[i % RECORDS] );
+        void const* const object( __atomic_load_n(&record.report.object, __ATOMIC_ACQUIRE) );
+        if( (object == NULLPTR) || (object == REMOVED) || (record.kind != kind) )
+        {
+            continue;
+        }
+        // Merge an object once, when its first record is met
+        bool_t isMerged( false );
+        for(int32_t j(0); (j < i) && !isMerged; j++)
+        {
+            Record const& other( buffers_[j / RECORDS].records[j % RECORDS] );
+            isMerged = (__atomic_load_n(&other.report.object, __ATOMIC_ACQUIRE) == object) && (other.kind == kind);
+        }
+        if( isMerged )
+        {
+            continue;
+        }
+        Report report = Report();
+        report.object = object;
+        for(int32_t j(i); j < buffers * RECORDS; j++)
+        {
+            Record const& other( buffers_[j / RECORDS].records[j % RECORDS] );
+            if( (__atomic_load_n(&other.report.object, __ATOMIC_ACQUIRE) == object) && (other.kind == kind) )
+            {
+                merge(report, other.report);
+            }
+        }
+        // Insert the report to the array ordered by wait time
+        int32_t index( (size < number) ? size : number );
+        while( (index > 0) && (reports[index - 1].waitTime < report.waitTime) )
+        {
+            if( index < number )
+            {
+                reports[index] = reports[index - 1];
+            }
+            index--;
+        }
+        if( index < number )
+        {
+            reports[index] = report;
+            if( size < number )
+            {
+                size++;
+            }
+        }
+    }
+    return size;
+}
+
+int64_t Contention::getDropped()
+{
+    return dropped_.load();
+}
+
+Contention::Report* Contention::getReport(void const* const object, Kind const kind)
+{
+    Report* report( NULLPTR );
+    Buffer* const buffer( getBuffer() );
+    if( buffer != NULLPTR )
+    {
+        // Open addressing by the Fibonacci hash of the object address, a removed record is
+        // passed over to find the object further, and is taken if the object is not found
+        uint32_t const hash( static_cast<uint32_t>( (reinterpret_cast<size_t>(object) >> 4) * 2654435761U ) );
+        Record* removed( NULLPTR );
+        Record* empty( NULLPTR );
+        for(int32_t i(0); (i < RECORDS) && (report == NULLPTR) && (empty == NULLPTR); i++)
+        {
+            Record& record( buffer->records[(hash + static_cast<uint32_t>(i)) % static_cast<uint32_t>(RECORDS)] );
+            void const* const address( __atomic_load_n(&record.report.object, __ATOMIC_ACQUIRE) );
+            if( address == NULLPTR )
+            {
+                empty = &record;
+            }
+            else if( (address == object) && (record.kind == kind) )
+            {
+                report = &record.report;
+            }
+            else if( (address == REMOVED) && (removed == NULLPTR) )
+            {
+                removed = &record;
+            }
+            else
+            {
+                continue;
+            }
+        }
+        if( report == NULLPTR )
+        {
+            Record* const record( (removed != NULLPTR) ? removed : empty );
+            if( record != NULLPTR )
+            {
+                record->kind = kind;
+                __atomic_store_n(&record->report.object, object, __ATOMIC_RELEASE);
+                report = &record->report;
+            }
+        }
+    }
+    if( report == NULLPTR )
+    {
+        static_cast<void>( dropped_.fetchAdd(1, Atomic<int64_t>::ORDER_RELAXED) );
+    }
+    return report;
+}
+
+Contention::Buffer* Contention::getBuffer()
+{
+    if( buffer_ == NULLPTR )
+    {
+        static_cast<void>( ::pthread_once(&once_, createKey) );
+        for(int32_t i(0); (i < THREADS) && (buffer_ == NULLPTR); i++)
+        {
+            int32_t expected( 0 );
+            if( __atomic_compare_exchange_n(&buffers_[i].isUsed, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) )
+            {
+                buffer_ = &buffers_[i];
+                // The buffer is returned at exit of the thread
+                static_cast<void>( ::pthread_setspecific(key_, buffer_) );
+                int32_t count( count_.load(Atomic<int32_t>::ORDER_RELAXED) );
+                bool_t isCounted( count > i );
+                while( !isCounted )
+                {
+                    isCounted = count_.compareExchange(count, i + 1) || (count > i);
+                }
+            }
+        }
+    }
+    return buffer_;
+}
+
+void Contention::createKey()
+{
+    static_cast<void>( ::pthread_key_create(&key_, returnBuffer) );
+}
+
+void Contention::returnBuffer(void* const buffer)
+{
+    __atomic_store_n(&static_cast<Buffer*>(buffer)->isUsed, 0, __ATOMIC_RELEASE);
+}
+
+void Contention::clear(Report& report)
+{
+    int64_t* const counters[] = { &report.acquisitions, &report.contentions, &report.failures, &report.waitTime, &report.holdTime };
+    for(size_t i(0U); i < sizeof(counters) / sizeof(counters[0]); i++)
+    {
+        __atomic_store_n(counters[i], 0, __ATOMIC_RELAXED);
+    }
+    for(int32_t i(0); i < BUCKETS; i++)
+    {
+        __atomic_store_n(&report.waits[i], 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&report.holds[i], 0, __ATOMIC_RELAXED);
+    }
+    for(int32_t i(0); i < SITES; i++)
+    {
+        __atomic_store_n(&report.sites[i].address, NULLPTR, __ATOMIC_RELAXED);
+        __atomic_store_n(&report.sites[i].count, 0, __ATOMIC_RELAXED);
+    }
+}
+
+int32_t Contention::getBucket(int64_t const time)
+{
+    int32_t bucket( 0 );
+    if( time > 1 )
+    {
+        bucket = 63 - __builtin_clzll( static_cast<uint64_t>(time) );
+    }
+    return (bucket < BUCKETS) ? bucket : (BUCKETS - 1);
+}
+
+void Contention::addSite(Report& report, void const* const site)
+{
+    // Count the call site, or replace the least counted one as the space-saving algorithm does
+    int32_t index( 0 );
+    bool_t isFound( false );
+    for(int32_t i(0); (i < SITES) && !isFound; i++)
+    {
+        if( report.sites[i].address == site )
+        {
+            index = i;
+            isFound = true;
+        }
+        else if( report.sites[i].count < report.sites[index].count )
+        {
+            index = i;
+        }
+        else
+        {
+            continue;
+        }
+    }
+    if( !isFound )
+    {
+        __atomic_store_n(&report.sites[index].address, site, __ATOMIC_RELAXED);
+    }
+    add(report.sites[index].count, 1);
+}
+
+void Contention::merge(Report& report, Report const& record)
+{
+    report.acquisitions += get(record.acquisitions);
+    report.contentions += get(record.contentions);
+    report.failures += get(record.failures);
+    report.waitTime += get(record.waitTime);
+    report.holdTime += get(record.holdTime);
+    for(int32_t i(0); i < BUCKETS; i++)
+    {
+        report.waits[i] += get(record.waits[i]);
+        report.holds[i] += get(record.holds[i]);
+    }
+    for(int32_t i(0); i < SITES; i++)
+    {
+        void const* const address( __atomic_load_n(&record.sites[i].address, __ATOMIC_RELAXED) );
+        int64_t const count( get(record.sites[i].count) );
+        if( (address == NULLPTR) || (count == 0) )
+        {
+            continue;
+        }
+        // Sum counts of the same site, or keep the most counted sites
+        int32_t index( 0 );
+        bool_t isFound( false );
+        for(int32_t j(0); (j < SITES) && !isFound; j++)
+        {
+            if( report.sites[j].address == address )
+            {
+                index = j;
+                isFound = true;
+            }
+            else if( report.sites[j].count < report.sites[index].count )
+            {
+                index = j;
+            }
+            else
+            {
+                continue;
+            }
+        }
+        if( isFound )
+        {
+            report.sites[index].count += count;
+        }
+        else if( report.sites[index].count < count )
+        {
+            report.sites[index].address = address;
+            report.sites[index].count = count;
+        }
+        else
+        {
+            continue;
+        }
+    }
+}
+
+void Contention::add(int64_t& counter, int64_t const value)
+{
+    __atomic_store_n(&counter, __atomic_load_n(&counter, __ATOMIC_RELAXED) + value, __ATOMIC_RELAXED);
+}
+
+int64_t Contention::get(int64_t const& counter)
+{
+    return __atomic_load_n(&counter, __ATOMIC_RELAXED);
+}
+
+#else // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+
+int32_t Contention::getReports(Kind, Report*, int32_t)
+{
+    return 0;
+}
+
+int64_t Contention::getDropped()
+{
+    return 0;
+}
+
+#endif // EOOS_GLOBAL_SYS_CONTENTION_PROFILE
+
+} // namespace sys
+} // namespace eoos
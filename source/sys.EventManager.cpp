@@ -0,0 +1,117 @@
+/**
+ * @file      sys.EventManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.EventManager.hpp"
+#include "lib.UniquePointer.hpp"
+#include "lib.Assert.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+api::Heap* EventManager::resource_( NULLPTR );
+
+EventManager::EventManager()
+    : NonCopyable<NoAllocator>()
+    , pool_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+EventManager::~EventManager()
+{
+    EventManager::deinitialize();
+}
+
+bool_t EventManager::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+Event<EventManager>* EventManager::create(Event<EventManager>::Mode const mode, bool_t const isSet)
+{
+    Resource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        Resource* resource( new Resource(mode, isSet) );
+        lib::UniquePointer<Resource> res( resource );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+void EventManager::remove(Event<EventManager>* const event)
+{
+    if( event != NULLPTR )
+    {
+        delete event;
+    }
+}
+
+bool_t EventManager::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( pool_.memory.isConstructed() )
+        {
+            if( initialize(&pool_.memory) )
+            {
+                res = true;
+            }
+        }
+    }
+    return res;
+}
+
+void* EventManager::allocate(size_t size)
+{
+    void* addr( NULLPTR );
+    if( resource_ != NULLPTR )
+    {
+        addr = resource_->allocate(size, NULLPTR);
+        EOOS_ASSERT( addr != NULLPTR );
+    }
+    return addr;
+}
+
+void EventManager::free(void* ptr)
+{
+    if( resource_ != NULLPTR )
+    {
+        resource_->free(ptr);
+    }
+}
+
+bool_t EventManager::initialize(api::Heap* resource)
+{
+    bool_t res( false );
+    if( resource_ == NULLPTR )
+    {
+        resource_ = resource;
+        res = true;
+    }
+    return res;
+}
+
+void EventManager::deinitialize()
+{
+    resource_ = NULLPTR;
+}
+
+EventManager::ResourcePool::ResourcePool()
+    : memory() {
+}
+
+} // namespace sys
+} // namespace eoos
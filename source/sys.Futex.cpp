@@ -0,0 +1,166 @@
+/**
+ * @file      sys.Futex.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.Futex.hpp"
+#include "sys.Clock.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+bool_t Futex::wait(int32_t* const addr, int32_t const expected, int64_t const timeout)
+{
+    bool_t res( false );
+    ::timespec time = { 0, 0 };
+    ::timespec* ptr( NULLPTR );
+    if( timeout >= 0 )
+    {
+        time.tv_sec = static_cast< ::time_t >(timeout / 1000000000LL);
+        time.tv_nsec = static_cast<long>(timeout % 1000000000LL);
+        ptr = &time;
+    }
+    long const error( ::syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, expected, ptr, NULLPTR, 0) );
+    if( (error == 0) || (errno == EAGAIN) || (errno == EINTR) )
+    {
+        res = true;
+    }
+    return res;
+}
+
+int32_t Futex::wake(int32_t* const addr, int32_t const number)
+{
+    int32_t res( 0 );
+    long const woken( ::syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, number, NULLPTR, NULLPTR, 0) );
+    if( woken > 0 )
+    {
+        res = static_cast<int32_t>(woken);
+    }
+    return res;
+}
+
+int32_t Futex::requeue(int32_t* const addr, int32_t const expected, int32_t const number, int32_t* const target)
+{
+    int32_t res( -1 );
+    // The timeout argument of the call is the maximum number of threads to move
+    void* const moved( reinterpret_cast<void*>(static_cast<long>(0x7FFFFFFF)) );
+    long const count( ::syscall(SYS_futex, addr, FUTEX_CMP_REQUEUE_PRIVATE, number, moved, target, expected) );
+    if( count >= 0 )
+    {
+        res = static_cast<int32_t>(count);
+    }
+    return res;
+}
+
+int32_t Futex::waitAny(int32_t* const* const addrs, int32_t const* const expected, int32_t const number, int64_t const timeout)
+{
+    int32_t res( -1 );
+    if( (addrs != NULLPTR) && (expected != NULLPTR) && (number > 0) && (number <= WAIT_ANY_MAX) )
+    {
+        res = findChanged(addrs, expected, number);
+        if( res < 0 )
+        {
+            int64_t const deadline( (timeout >= 0) ? (Clock::getTime() + timeout) : TIMEOUT_INFINITE );
+            if( !waitVector(addrs, expected, number, deadline, res) )
+            {
+                res = waitPolled(addrs, expected, number, deadline);
+            }
+        }
+    }
+    return res;
+}
+
+int32_t Futex::findChanged(int32_t* const* const addrs, int32_t const* const expected, int32_t const number)
+{
+    int32_t res( -1 );
+    for(int32_t i(0); (i < number) && (res < 0); i++)
+    {
+        if( __atomic_load_n(addrs[i], __ATOMIC_ACQUIRE) != expected[i] )
+        {
+            res = i;
+        }
+    }
+    return res;
+}
+
+bool_t Futex::waitVector(int32_t* const* const addrs, int32_t const* const expected, int32_t const number, int64_t const deadline, int32_t& index)
+{
+    bool_t res( false );
+    index = -1;
+    #if defined (SYS_futex_waitv) && defined (FUTEX_WAITV_MAX)
+    ::futex_waitv waiters[WAIT_ANY_MAX];
+    for(int32_t i(0); i < number; i++)
+    {
+        waiters[i].val = static_cast<uint64_t>( static_cast<uint32_t>(expected[i]) );
+        waiters[i].uaddr = static_cast<uint64_t>( reinterpret_cast<size_t>(addrs[i]) );
+        waiters[i].flags = FUTEX_32 | FUTEX_PRIVATE_FLAG;
+        waiters[i].__reserved = 0U;
+    }
+    ::timespec time = { 0, 0 };
+    ::timespec* ptr( NULLPTR );
+    if( deadline >= 0 )
+    {
+        time.tv_sec = static_cast< ::time_t >(deadline / 1000000000LL);
+        time.tv_nsec = static_cast<long>(deadline % 1000000000LL);
+        ptr = &time;
+    }
+    long woken( -1 );
+    do
+    {
+        // The timeout of the call is absolute, thus an interrupted call is repeated with it
+        woken = ::syscall(SYS_futex_waitv, waiters, number, 0, ptr, CLOCK_MONOTONIC);
+    }
+    while( (woken < 0) && (errno == EINTR) );
+    if( woken >= 0 )
+    {
+        index = static_cast<int32_t>(woken);
+        res = true;
+    }
+    else if( errno == EAGAIN )
+    {
+        index = findChanged(addrs, expected, number);
+        res = true;
+    }
+    else
+    {
+        // The call is not provided by kernels older than 5.16
+        res = errno != ENOSYS;
+    }
+    #else
+    static_cast<void>( addrs );
+    static_cast<void>( expected );
+    static_cast<void>( number );
+    static_cast<void>( deadline );
+    #endif // SYS_futex_waitv
+    return res;
+}
+
+int32_t Futex::waitPolled(int32_t* const* const addrs, int32_t const* const expected, int32_t const number, int64_t const deadline)
+{
+    int32_t res( -1 );
+    bool_t isExpired( false );
+    while( (res < 0) && !isExpired )
+    {
+        int64_t slice( POLL_SLICE );
+        if( deadline >= 0 )
+        {
+            int64_t const left( deadline - Clock::getTime() );
+            slice = (left < slice) ? left : slice;
+        }
+        if( slice > 0 )
+        {
+            static_cast<void>( wait(addrs[0], expected[0], slice) );
+            res = findChanged(addrs, expected, number);
+        }
+        else
+        {
+            isExpired = true;
+        }
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
@@ -32,13 +32,92 @@ bool_t MutexManager::isConstructed() const
     return Parent::isConstructed();
 }
 
-api::Mutex* MutexManager::create()
+ConditionMutex* MutexManager::create()
 {
-    api::Mutex* ptr( NULLPTR );
+    MutexAttributes const attributes;
+    return create(attributes);
+}
+
+ConditionMutex* MutexManager::create(MutexAttributes const& attributes)
+{
+    ConditionMutex* ptr( NULLPTR );
     if( isConstructed() )
     {
-        api::Mutex* resource( new Resource() );
-        lib::UniquePointer<api::Mutex> res( resource );
+        ConditionMutex* resource( createResource(attributes, NULLPTR) );
+        lib::UniquePointer<ConditionMutex> res( resource );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {   ///< UT Justified Branch: OS dependency
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+ConditionMutex* MutexManager::create(void* const storage)
+{
+    MutexAttributes const attributes;
+    return create(storage, attributes);
+}
+
+ConditionMutex* MutexManager::create(void* const storage, MutexAttributes const& attributes)
+{
+    ConditionMutex* ptr( NULLPTR );
+    if( isConstructed() && (storage != NULLPTR) && ( (reinterpret_cast<size_t>(storage) % STORAGE_ALIGNMENT) == 0U ) )
+    {
+        ptr = createResource(attributes, storage);
+        if( !ptr->isConstructed() )
+        {   ///< UT Justified Branch: OS dependency
+            destroy(ptr);
+            ptr = NULLPTR;
+        }
+    }
+    return ptr;
+}
+
+void MutexManager::destroy(api::Mutex* const mutex)
+{
+    if( mutex != NULLPTR )
+    {
+        mutex->~Mutex();
+    }
+}
+
+Mutex<MutexManager>* MutexManager::createShared(void* const memory)
+{
+    MutexAttributes const attributes;
+    return createShared(memory, attributes);
+}
+
+Mutex<MutexManager>* MutexManager::createShared(void* const memory, MutexAttributes const& attributes)
+{
+    Mutex<MutexManager>* ptr( NULLPTR );
+    // Only a POSIX mutex is shared between processes
+    bool_t const isPosix( (attributes.kind == MutexAttributes::KIND_DEFAULT) || (attributes.kind == MutexAttributes::KIND_POSIX) );
+    if( isConstructed() && isPosix && (memory != NULLPTR) && ( (reinterpret_cast<size_t>(memory) % SHARED_ALIGNMENT) == 0U ) )
+    {
+        lib::UniquePointer< Mutex<MutexManager> > res( new Mutex<MutexManager>(attributes, static_cast< ::pthread_mutex_t* >(memory)) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {   ///< UT Justified Branch: OS dependency
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+Mutex<MutexManager>* MutexManager::openShared(void* const memory)
+{
+    Mutex<MutexManager>* ptr( NULLPTR );
+    if( isConstructed() && (memory != NULLPTR) && ( (reinterpret_cast<size_t>(memory) % SHARED_ALIGNMENT) == 0U ) )
+    {
+        lib::UniquePointer< Mutex<MutexManager> > res( new Mutex<MutexManager>(static_cast< ::pthread_mutex_t* >(memory)) );
         if( !res.isNull() )
         {
             if( !res->isConstructed() )
@@ -51,6 +130,16 @@ api::Mutex* MutexManager::create()
     return ptr;
 }
 
+int32_t MutexManager::getReports(Contention::Report* const reports, int32_t const number) const
+{
+    int32_t res( 0 );
+    if( isConstructed() && (reports != NULLPTR) && (number > 0) )
+    {
+        res = Contention::getReports(Contention::KIND_MUTEX, reports, number);
+    }
+    return res;
+}
+
 bool_t MutexManager::construct()
 {
     bool_t res( false );
@@ -70,9 +159,9 @@ bool_t MutexManager::construct()
 void* MutexManager::allocate(size_t size)
 {
     void* addr( NULLPTR );
-    if( resource_ != NULLPTR )
+    if( (resource_ != NULLPTR) && (size <= sizeof(Resource)) )
     {
-        addr = resource_->allocate(size, NULLPTR);
+        addr = resource_->allocate(sizeof(Resource), NULLPTR);
         EOOS_ASSERT( addr != NULLPTR );
     }
     return addr;
@@ -102,9 +191,49 @@ void MutexManager::deinitialize()
     resource_ = NULLPTR;
 }
 
+template <class R>
+ConditionMutex* MutexManager::newResource(MutexAttributes const& attributes, void* const storage)
+{
+    ConditionMutex* resource( NULLPTR );
+    if( storage == NULLPTR )
+    {
+        resource = new R(attributes);
+    }
+    else
+    {
+        resource = new (storage) R(attributes);
+    }
+    return resource;
+}
+
+ConditionMutex* MutexManager::createResource(MutexAttributes const& attributes, void* const storage)
+{
+    ConditionMutex* resource( NULLPTR );
+    if( attributes.kind == MutexAttributes::KIND_POSIX )
+    {
+        resource = newResource< Mutex<MutexManager> >(attributes, storage);
+    }
+    else if( attributes.kind == MutexAttributes::KIND_FUTEX )
+    {
+        resource = newResource< FutexMutex<MutexManager> >(attributes, storage);
+    }
+    else if( attributes.kind == MutexAttributes::KIND_QUEUE )
+    {
+        resource = newResource< QueueMutex<MutexManager> >(attributes, storage);
+    }
+    else
+    {
+        #ifdef EOOS_GLOBAL_SYS_MUTEX_FUTEX
+        resource = newResource< FutexMutex<MutexManager> >(attributes, storage);
+        #else
+        resource = newResource< Mutex<MutexManager> >(attributes, storage);
+        #endif // EOOS_GLOBAL_SYS_MUTEX_FUTEX
+    }
+    return resource;
+}
+
 MutexManager::ResourcePool::ResourcePool()
-    : mutex_()
-    , memory( mutex_ ) {
+    : memory() {
 }
 
 } // namespace sys
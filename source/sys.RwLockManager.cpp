@@ -0,0 +1,115 @@
+/**
+ * @file      sys.RwLockManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2026, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.RwLockManager.hpp"
+#include "lib.UniquePointer.hpp"
+#include "lib.Assert.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+api::Heap* RwLockManager::resource_( NULLPTR );
+
+RwLockManager::RwLockManager()
+    : NonCopyable<NoAllocator>()
+    , pool_() {
+    bool_t const isConstructed( construct() );
+    setConstructed( isConstructed );
+}
+
+RwLockManager::~RwLockManager()
+{
+    RwLockManager::deinitialize();
+}
+
+bool_t RwLockManager::isConstructed() const
+{
+    return Parent::isConstructed();
+}
+
+RwLock<RwLockManager>* RwLockManager::create()
+{
+    RwLockAttributes const attributes;
+    return create(attributes);
+}
+
+RwLock<RwLockManager>* RwLockManager::create(RwLockAttributes const& attributes)
+{
+    Resource* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        Resource* resource( new Resource(attributes) );
+        lib::UniquePointer<Resource> res( resource );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {   ///< UT Justified Branch: OS dependency
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+bool_t RwLockManager::construct()
+{
+    bool_t res( false );
+    if( isConstructed() )
+    {
+        if( pool_.memory.isConstructed() )
+        {
+            if( initialize(&pool_.memory) )
+            {
+                res = true;
+            }
+        }
+    }
+    return res;
+}
+
+void* RwLockManager::allocate(size_t size)
+{
+    void* addr( NULLPTR );
+    if( resource_ != NULLPTR )
+    {
+        addr = resource_->allocate(size, NULLPTR);
+        EOOS_ASSERT( addr != NULLPTR );
+    }
+    return addr;
+}
+
+void RwLockManager::free(void* ptr)
+{
+    if( resource_ != NULLPTR )
+    {
+        resource_->free(ptr);
+    }
+}
+
+bool_t RwLockManager::initialize(api::Heap* resource)
+{
+    bool_t res( false );
+    if( resource_ == NULLPTR )
+    {
+        resource_ = resource;
+        res = true;
+    }
+    return res;
+}
+
+void RwLockManager::deinitialize()
+{
+    resource_ = NULLPTR;
+}
+
+RwLockManager::ResourcePool::ResourcePool()
+    : memory() {
+}
+
+} // namespace sys
+} // namespace eoos
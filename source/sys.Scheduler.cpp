@@ -50,6 +50,47 @@ api::Thread* Scheduler::createThread(api::Task& task)
     return ptr;
 }
 
+api::Thread* Scheduler::createThread(void* const storage, api::Task& task)
+{
+    api::Thread* ptr( NULLPTR );
+    if( isConstructed() && (storage != NULLPTR) && ( (reinterpret_cast<size_t>(storage) % STORAGE_ALIGNMENT) == 0U ) )
+    {
+        ptr = new (storage) Resource(task);
+        if( !ptr->isConstructed() )
+        {
+            destroyThread(ptr);
+            ptr = NULLPTR;
+        }
+    }
+    return ptr;
+}
+
+void Scheduler::destroyThread(api::Thread* const thread)
+{
+    if( thread != NULLPTR )
+    {
+        thread->~Thread();
+    }
+}
+
+api::Thread* Scheduler::createDedicatedThread(api::Task& task, int32_t cpu)
+{
+    api::Thread* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<api::Thread> res( new Resource(task, cpu) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
 bool_t Scheduler::sleep(int32_t ms)
 {
     bool_t res( false );
@@ -214,8 +255,7 @@ void Scheduler::deinitialize()
 }
 
 Scheduler::ResourcePool::ResourcePool()
-    : mutex_()
-    , memory( mutex_ ) {
+    : memory() {
 }
 
 } // namespace sys
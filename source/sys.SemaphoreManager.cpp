@@ -1,7 +1,7 @@
 /**
  * @file      sys.SemaphoreManager.cpp
  * @author    Sergey Baigudin, sergey@baigudin.software
- * @copyright 2023, Sergey Baigudin, Baigudin Software
+ * @copyright 2023-2026, Sergey Baigudin, Baigudin Software
  */
 #include "sys.SemaphoreManager.hpp"
 #include "lib.UniquePointer.hpp"
@@ -32,12 +32,117 @@ bool_t SemaphoreManager::isConstructed() const
     return Parent::isConstructed();
 }
 
-api::Semaphore* SemaphoreManager::create(int32_t permits)
+CountingSemaphore* SemaphoreManager::create(int32_t permits)
 {
-    api::Semaphore* ptr( NULLPTR );
+    return create(permits, false);
+}
+
+CountingSemaphore* SemaphoreManager::create(int32_t const permits, bool_t const isFair)
+{
+    CountingSemaphore* ptr( NULLPTR );
+    if( isConstructed() )
+    {
+        lib::UniquePointer<CountingSemaphore> res( createResource(permits, isFair, NULLPTR) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+CountingSemaphore* SemaphoreManager::create(void* const storage, int32_t permits)
+{
+    return create(storage, permits, false);
+}
+
+CountingSemaphore* SemaphoreManager::create(void* const storage, int32_t const permits, bool_t const isFair)
+{
+    CountingSemaphore* ptr( NULLPTR );
+    if( isConstructed() && (storage != NULLPTR) && ( (reinterpret_cast<size_t>(storage) % STORAGE_ALIGNMENT) == 0U ) )
+    {
+        ptr = createResource(permits, isFair, storage);
+        if( !ptr->isConstructed() )
+        {
+            destroy(ptr);
+            ptr = NULLPTR;
+        }
+    }
+    return ptr;
+}
+
+EventSemaphore<SemaphoreManager>* SemaphoreManager::createPollable(int32_t const permits)
+{
+    EventSemaphore<SemaphoreManager>* ptr( NULLPTR );
     if( isConstructed() )
     {
-        lib::UniquePointer<api::Semaphore> res( new Resource(permits) );
+        lib::UniquePointer< EventSemaphore<SemaphoreManager> > res( new EventSemaphore<SemaphoreManager>(permits) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+void SemaphoreManager::destroy(api::Semaphore* const semaphore)
+{
+    if( semaphore != NULLPTR )
+    {
+        semaphore->~Semaphore();
+    }
+}
+
+CountingSemaphore* SemaphoreManager::createShared(void* const memory, int32_t permits)
+{
+    CountingSemaphore* ptr( NULLPTR );
+    if( isConstructed() && (memory != NULLPTR) && ( (reinterpret_cast<size_t>(memory) % SHARED_ALIGNMENT) == 0U ) )
+    {
+        lib::UniquePointer<CountingSemaphore> res( new Semaphore<SemaphoreManager>(permits, static_cast< ::sem_t* >(memory)) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+CountingSemaphore* SemaphoreManager::openShared(void* const memory)
+{
+    CountingSemaphore* ptr( NULLPTR );
+    if( isConstructed() && (memory != NULLPTR) && ( (reinterpret_cast<size_t>(memory) % SHARED_ALIGNMENT) == 0U ) )
+    {
+        lib::UniquePointer<CountingSemaphore> res( new Semaphore<SemaphoreManager>(static_cast< ::sem_t* >(memory)) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+CountingSemaphore* SemaphoreManager::createNamed(char_t const* const name, int32_t const permits)
+{
+    CountingSemaphore* ptr( NULLPTR );
+    if( isConstructed() && (name != NULLPTR) )
+    {
+        lib::UniquePointer<CountingSemaphore> res( new Semaphore<SemaphoreManager>(name, permits) );
         if( !res.isNull() )
         {
             if( !res->isConstructed() )
@@ -50,6 +155,44 @@ api::Semaphore* SemaphoreManager::create(int32_t permits)
     return ptr;
 }
 
+CountingSemaphore* SemaphoreManager::openNamed(char_t const* const name)
+{
+    CountingSemaphore* ptr( NULLPTR );
+    if( isConstructed() && (name != NULLPTR) )
+    {
+        lib::UniquePointer<CountingSemaphore> res( new Semaphore<SemaphoreManager>(name) );
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {
+                res.reset();
+            }
+        }
+        ptr = res.release();
+    }
+    return ptr;
+}
+
+bool_t SemaphoreManager::unlinkNamed(char_t const* const name)
+{
+    bool_t res( false );
+    if( isConstructed() && (name != NULLPTR) )
+    {
+        res = ::sem_unlink(name) == 0;
+    }
+    return res;
+}
+
+int32_t SemaphoreManager::getReports(Contention::Report* const reports, int32_t const number) const
+{
+    int32_t res( 0 );
+    if( isConstructed() && (reports != NULLPTR) && (number > 0) )
+    {
+        res = Contention::getReports(Contention::KIND_SEMAPHORE, reports, number);
+    }
+    return res;
+}
+
 bool_t SemaphoreManager::construct()
 {
     bool_t res( false );
@@ -69,9 +212,9 @@ bool_t SemaphoreManager::construct()
 void* SemaphoreManager::allocate(size_t size)
 {
     void* addr( NULLPTR );
-    if( resource_ != NULLPTR )
+    if( (resource_ != NULLPTR) && (size <= sizeof(Resource)) )
     {
-        addr = resource_->allocate(size, NULLPTR);
+        addr = resource_->allocate(sizeof(Resource), NULLPTR);
         EOOS_ASSERT( addr != NULLPTR );
     }
     return addr;
@@ -101,9 +244,41 @@ void SemaphoreManager::deinitialize()
     resource_ = NULLPTR;
 }
 
+template <class R>
+CountingSemaphore* SemaphoreManager::newResource(int32_t const permits, void* const storage)
+{
+    CountingSemaphore* resource( NULLPTR );
+    if( storage == NULLPTR )
+    {
+        resource = new R(permits);
+    }
+    else
+    {
+        resource = new (storage) R(permits);
+    }
+    return resource;
+}
+
+CountingSemaphore* SemaphoreManager::createResource(int32_t const permits, bool_t const isFair, void* const storage)
+{
+    CountingSemaphore* resource( NULLPTR );
+    if( isFair )
+    {
+        resource = newResource< FairSemaphore<SemaphoreManager> >(permits, storage);
+    }
+    else
+    {
+        #ifdef EOOS_GLOBAL_SYS_SEMAPHORE_FUTEX
+        resource = newResource< FutexSemaphore<SemaphoreManager> >(permits, storage);
+        #else
+        resource = newResource< Semaphore<SemaphoreManager> >(permits, storage);
+        #endif // EOOS_GLOBAL_SYS_SEMAPHORE_FUTEX
+    }
+    return resource;
+}
+
 SemaphoreManager::ResourcePool::ResourcePool()
-    : mutex_()
-    , memory( mutex_ ) {
+    : memory() {
 }
 
 } // namespace sys
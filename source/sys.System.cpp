@@ -18,6 +18,9 @@ System::System()
     , heap_()
     , scheduler_()
     , mutexManager_()
+    , rwLockManager_()
+    , conditionVariableManager_()
+    , eventManager_()
     , semaphoreManager_()
     , streamManager_() {
     bool_t const isConstructed( construct() );
@@ -44,12 +47,57 @@ api::Heap& System::getHeap()
     return heap_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
 }
 
-api::MutexManager& System::getMutexManager()
+MutexManager& System::getMutexManager()
 {
     return mutexManager_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
 }
 
-api::SemaphoreManager& System::getSemaphoreManager()
+RwLockManager& System::getRwLockManager()
+{
+    return rwLockManager_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
+}
+
+ConditionVariableManager& System::getConditionVariableManager()
+{
+    return conditionVariableManager_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
+}
+
+EventManager& System::getEventManager()
+{
+    return eventManager_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
+}
+
+bool_t System::waitOnAddress(int32_t* const addr, int32_t const expected, int64_t const timeout)
+{
+    bool_t res( false );
+    if( isConstructed() && (addr != NULLPTR) )
+    {
+        res = Futex::wait(addr, expected, timeout);
+    }
+    return res;
+}
+
+int32_t System::waitOnAddresses(int32_t* const* const addrs, int32_t const* const expected, int32_t const number, int64_t const timeout)
+{
+    int32_t res( -1 );
+    if( isConstructed() )
+    {
+        res = Futex::waitAny(addrs, expected, number, timeout);
+    }
+    return res;
+}
+
+int32_t System::wakeAddress(int32_t* const addr, int32_t const number)
+{
+    int32_t res( 0 );
+    if( isConstructed() && (addr != NULLPTR) && (number > 0) )
+    {
+        res = Futex::wake(addr, number);
+    }
+    return res;
+}
+
+SemaphoreManager& System::getSemaphoreManager()
 {
     return semaphoreManager_; ///< SCA MISRA-C++:2008 Justified Rule 9-3-2
 }
@@ -63,7 +111,7 @@ int32_t System::run(api::Task& task)
 {
     int32_t error( -1 );
     System eoos;
-    if( eoos.isConstructed() )
+    if( eoos.isConstructed() && setMemoryPolicy() )
     {
         task.start();
         error = 0;
@@ -88,6 +136,9 @@ bool_t System::construct()
      && ( heap_.isConstructed() )
      && ( scheduler_.isConstructed() )
      && ( mutexManager_.isConstructed() )
+     && ( rwLockManager_.isConstructed() )
+     && ( conditionVariableManager_.isConstructed() )
+     && ( eventManager_.isConstructed() )
      && ( semaphoreManager_.isConstructed() )
      && ( streamManager_.isConstructed() ) )
     {
@@ -97,5 +148,98 @@ bool_t System::construct()
     return res;
 }
 
+bool_t System::setMemoryPolicy()
+{
+    bool_t res( true );
+    #if defined (EOOS_GLOBAL_SYS_MEMORY_NO_TRIM) || (EOOS_GLOBAL_SYS_MEMORY_HEAP_PREFAULT > 0)
+    // Keep freed memory in the heap, and serve all allocations from the heap, thus the heap prefaulted stays mapped
+    if( (::mallopt(M_TRIM_THRESHOLD, -1) == 0) || (::mallopt(M_MMAP_MAX, 0) == 0) )
+    {
+        res = false;
+    }
+    #endif // EOOS_GLOBAL_SYS_MEMORY_NO_TRIM || EOOS_GLOBAL_SYS_MEMORY_HEAP_PREFAULT
+    #ifdef EOOS_GLOBAL_SYS_MEMORY_LOCK
+    if( res )
+    {
+        int_t const error( ::mlockall(MCL_CURRENT | MCL_FUTURE) );
+        if( error != 0 )
+        {
+            res = false;
+        }
+    }
+    #endif // EOOS_GLOBAL_SYS_MEMORY_LOCK
+    if( res )
+    {
+        res = prefaultHeap(EOOS_GLOBAL_SYS_MEMORY_HEAP_PREFAULT);
+    }
+    if( res )
+    {
+        prefaultStack();
+    }
+    return res;
+}
+
+bool_t System::prefaultHeap(size_t const size)
+{
+    bool_t res( true );
+    if( size != 0U )
+    {
+        res = false;
+        long const page( ::sysconf(_SC_PAGESIZE) );
+        uint8_t* const addr( reinterpret_cast<uint8_t*>( ::malloc(size) ) );
+        if( (addr != NULLPTR) && (page > 0) )
+        {
+            uint8_t volatile* const memory( addr );
+            for(size_t i(0U); i < size; i += static_cast<size_t>(page))
+            {
+                memory[i] = 0U;
+            }
+            ::free(addr);
+            res = true;
+        }
+    }
+    return res;
+}
+
+void System::prefaultStack()
+{
+    #if EOOS_GLOBAL_SYS_MEMORY_STACK_PREFAULT > 0
+    // The memory is allocated in the frame of the function, as a fixed array may overflow the stack
+    size_t const size( getStackPrefault(EOOS_GLOBAL_SYS_MEMORY_STACK_PREFAULT) );
+    long const page( ::sysconf(_SC_PAGESIZE) );
+    if( (size > 0U) && (page > 0) )
+    {
+        uint8_t volatile* const memory( static_cast<uint8_t*>( ::alloca(size) ) );
+        for(size_t i(0U); i < size; i += static_cast<size_t>(page))
+        {
+            memory[i] = 0U;
+        }
+    }
+    #endif // EOOS_GLOBAL_SYS_MEMORY_STACK_PREFAULT
+}
+
+size_t System::getStackPrefault(size_t const size)
+{
+    size_t res( 0U );
+    ::pthread_attr_t attr;
+    if( ::pthread_getattr_np(::pthread_self(), &attr) == 0 )
+    {
+        void* base( NULLPTR );
+        size_t length( 0U );
+        if( ::pthread_attr_getstack(&attr, &base, &length) == 0 )
+        {
+            // The stack of the primary thread is limited by RLIMIT_STACK, and grows down to the base
+            uint8_t const local( 0U );
+            size_t const top( reinterpret_cast<size_t>(&local) );
+            size_t const bottom( reinterpret_cast<size_t>(base) );
+            size_t const available( (top > bottom) ? (top - bottom) : 0U );
+            size_t const limit( (available > STACK_MARGIN) ? (available - STACK_MARGIN) : 0U );
+            res = (size < limit) ? size : limit;
+        }
+        static_cast<void>( ::pthread_attr_destroy(&attr) );
+    }
+    return res;
+}
+
 } // namespace sys
 } // namespace eoos